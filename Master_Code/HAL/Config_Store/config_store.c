@@ -0,0 +1,433 @@
+/* 
+ * File:   config_store.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:10 PM
+ */
+
+#include "config_store.h"
+
+#define CONFIG_STORE_NO_SLOT        (uint8)0xFF
+#define CONFIG_STORE_RECORD_ADDRESS(slot)   (uint16)(CONFIG_STORE_START_ADDRESS + ((uint16)(slot) * CONFIG_STORE_RECORD_SIZE))
+
+/* RAM copy of a key and its newest record */
+typedef struct
+{
+    uint16 value;
+    uint16 sequence;
+    uint8 slot;                 // CONFIG_STORE_NO_SLOT if the key was never written
+    uint8 dirty;                // STD_HIGH if value isn't in the ring yet
+}config_store_entry_t;
+
+static uint16 config_store_crc(uint16 crc, uint8 data);
+static uint8 config_store_slot_used(uint8 slot);
+static Std_ReturnType config_store_append(uint8 key);
+
+static config_store_entry_t store_index[CONFIG_STORE_KEYS_NUM];
+static const config_store_field_t *store_fields = NULL;
+static uint16 store_sequence = ZERO_INIT;  // Sequence number of the newest record in the ring
+static uint8 store_next_slot = ZERO_INIT;  // Slot after the newest record
+
+/**
+ * @brief Scans the ring and builds the RAM copy of every key, keys never written or holding
+ *        a value out of their range take their default value. Call it once after EEPROM_Init().
+ * 
+ * @param fields The default value and the range of every key (CONFIG_STORE_KEYS_NUM entries).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_init(const config_store_field_t *fields)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_record[CONFIG_STORE_RECORD_SIZE];
+    uint8 l_slot = ZERO_INIT, l_key = ZERO_INIT, l_index = ZERO_INIT, l_found = STD_LOW;
+    uint16 l_sequence = ZERO_INIT, l_crc = ZERO_INIT;
+
+    store_fields = fields;
+    for(l_key = ZERO_INIT; l_key < CONFIG_STORE_KEYS_NUM; l_key++)
+    {
+        store_index[l_key].slot = CONFIG_STORE_NO_SLOT;
+        store_index[l_key].dirty = STD_LOW;
+    }
+    store_sequence = ZERO_INIT;
+    store_next_slot = ZERO_INIT;
+    if(NULL == fields)
+    {
+        ret = E_NOT_OK;
+    }else{/* Nothing */}
+    for(l_slot = ZERO_INIT; (l_slot < CONFIG_STORE_RECORDS_NUM) && (E_OK == ret); l_slot++)
+    {
+        ret = EEPROM_ReadBlock(CONFIG_STORE_RECORD_ADDRESS(l_slot), l_record, CONFIG_STORE_RECORD_SIZE);
+        l_key = l_record[CONFIG_STORE_KEY];
+        l_crc = CONFIG_STORE_CRC_SEED;
+        for(l_index = ZERO_INIT; l_index < CONFIG_STORE_CRC_HIGH; l_index++)
+        {
+            l_crc = config_store_crc(l_crc, l_record[l_index]);
+        }
+        //Erased slots and records torn by a reset fail the CRC and are skipped
+        if((E_OK == ret) && (l_key < CONFIG_STORE_KEYS_NUM) &&
+           (l_crc == (uint16)(((uint16)l_record[CONFIG_STORE_CRC_HIGH] << 8) |
+                                                   l_record[CONFIG_STORE_CRC_LOW])))
+        {
+            l_sequence = (uint16)(((uint16)l_record[CONFIG_STORE_SEQ_HIGH] << 8) | l_record[CONFIG_STORE_SEQ_LOW]);
+            if((CONFIG_STORE_NO_SLOT == store_index[l_key].slot) ||
+               ((sint16)(l_sequence - store_index[l_key].sequence) > 0))
+            {
+                store_index[l_key].value = (uint16)(((uint16)l_record[CONFIG_STORE_VALUE_HIGH] << 8) |
+                                                    l_record[CONFIG_STORE_VALUE_LOW]);
+                store_index[l_key].sequence = l_sequence;
+                store_index[l_key].slot = l_slot;
+            }else{/* Nothing */}
+            if((STD_LOW == l_found) || ((sint16)(l_sequence - store_sequence) > 0))
+            {
+                l_found = STD_HIGH;
+                store_sequence = l_sequence;
+                store_next_slot = (uint8)((l_slot + 1) % CONFIG_STORE_RECORDS_NUM);
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+    }
+    //A record that passes the CRC may still hold a value an older firmware allowed
+    for(l_key = ZERO_INIT; (l_key < CONFIG_STORE_KEYS_NUM) && (NULL != fields); l_key++)
+    {
+        if((CONFIG_STORE_NO_SLOT == store_index[l_key].slot) ||
+           (store_index[l_key].value < store_fields[l_key].min) || (store_index[l_key].value > store_fields[l_key].max))
+        {
+            store_index[l_key].value = store_fields[l_key].default_value;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the value of a key from RAM.
+ * 
+ * @param key The key (0 .. CONFIG_STORE_KEYS_NUM - 1).
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_read(uint8 key, uint16 *value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if((NULL == value) || (key >= CONFIG_STORE_KEYS_NUM) || (NULL == store_fields))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *value = store_index[key].value;
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the value of a key in RAM and marks it to be written by config_store_task().
+ *        No EEPROM access is done.
+ * 
+ * @param key The key (0 .. CONFIG_STORE_KEYS_NUM - 1).
+ * @param value The value, in the range of the key.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong key or value out of range, nothing is changed.
+ */
+Std_ReturnType config_store_write(uint8 key, uint16 value)
+{
+    Std_ReturnType ret = E_OK;
+
+    if((key >= CONFIG_STORE_KEYS_NUM) || (NULL == store_fields) ||
+       (value < store_fields[key].min) || (value > store_fields[key].max))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(value != store_index[key].value)
+    {
+        store_index[key].value = value;
+        store_index[key].dirty = STD_HIGH;
+    }
+    else
+    {
+        /* Nothing, the key already holds the value */
+    }
+    return ret;
+}
+
+/**
+ * @brief Background writer: queues the record of one marked key when the EEPROM is idle.
+ *        Call it from the polling loops, it returns at once.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_task(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_status = EEPROM_BUSY;
+    uint8 l_key = ZERO_INIT;
+
+    ret = EEPROM_Get_Status(&l_status);
+    if((E_OK == ret) && (EEPROM_IDLE == l_status))
+    {
+        for(l_key = ZERO_INIT; l_key < CONFIG_STORE_KEYS_NUM; l_key++)
+        {
+            if(STD_HIGH == store_index[l_key].dirty)
+            {
+                ret = config_store_append(l_key);
+                break;
+            }else{/* Nothing */}
+        }
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Queues the records of all the marked keys now, for values that must survive a reset
+ *        that may come before the next config_store_task(). It doesn't wait for the writes.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_flush(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_key = ZERO_INIT;
+
+    for(l_key = ZERO_INIT; (l_key < CONFIG_STORE_KEYS_NUM) && (E_OK == ret); l_key++)
+    {
+        if(STD_HIGH == store_index[l_key].dirty)
+        {
+            ret = config_store_append(l_key);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Finds the newest copy of an A/B record whose CRC matches and reads its data.
+ *        Call it once after EEPROM_Init(), before the first commit.
+ * 
+ * @param record A pointer to the record (slot addresses and size set).
+ * @param data A pointer to store the data (size bytes).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong parameters or no valid copy, data is left unchanged.
+ */
+Std_ReturnType config_store_record_load(config_record_t *record, uint8 *data)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_slot = ZERO_INIT, l_index = ZERO_INIT, l_byte = ZERO_INIT;
+    uint8 l_crc_high = ZERO_INIT, l_crc_low = ZERO_INIT;
+    uint16 l_address = ZERO_INIT, l_version = ZERO_INIT, l_crc = ZERO_INIT;
+
+    if((NULL == record) || (NULL == data) || (ZERO_INIT == record->size) || (record->size > CONFIG_RECORD_DATA_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        record->active_slot = CONFIG_RECORD_NO_SLOT;
+        record->version = ZERO_INIT;
+        for(l_slot = ZERO_INIT; (l_slot < CONFIG_RECORD_SLOTS_NUM) && (E_OK == ret); l_slot++)
+        {
+            //The copy is checked byte by byte so data keeps its content if both copies are bad
+            l_address = record->slot_address[l_slot];
+            l_crc = CONFIG_STORE_CRC_SEED;
+            l_version = ZERO_INIT;
+            for(l_index = ZERO_INIT; (l_index < (uint8)(record->size + 2)) && (E_OK == ret); l_index++)
+            {
+                ret = EEPROM_ReadByte(l_address + l_index, &l_byte);
+                l_crc = config_store_crc(l_crc, l_byte);
+                if(l_index < 2)
+                {
+                    l_version = (uint16)((l_version << 8) | l_byte);
+                }else{/* Nothing */}
+            }
+            if(E_OK == ret)
+            {
+                ret = EEPROM_ReadByte(l_address + l_index, &l_crc_high);
+            }else{/* Nothing */}
+            if(E_OK == ret)
+            {
+                ret = EEPROM_ReadByte(l_address + l_index + 1, &l_crc_low);
+            }else{/* Nothing */}
+            if((E_OK == ret) && (l_crc == (uint16)(((uint16)l_crc_high << 8) | l_crc_low)) &&
+               ((CONFIG_RECORD_NO_SLOT == record->active_slot) || ((sint16)(l_version - record->version) > 0)))
+            {
+                record->active_slot = l_slot;
+                record->version = l_version;
+            }else{/* Nothing */}
+        }
+        if((E_OK == ret) && (CONFIG_RECORD_NO_SLOT != record->active_slot))
+        {
+            ret = EEPROM_ReadBlock(record->slot_address[record->active_slot] + 2, data, record->size);
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes the data with the next version over the older copy of an A/B record.
+ *        The write runs in the background, the newest copy stays valid until it's complete.
+ * 
+ * @param record A pointer to the record.
+ * @param data The data (size bytes), it's copied so it may change after the call.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_record_commit(config_record_t *record, const uint8 *data)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_copy[EEPROM_QUEUE_SIZE];
+    uint8 l_slot = ZERO_INIT, l_index = ZERO_INIT, l_length = ZERO_INIT;
+    uint16 l_version = ZERO_INIT, l_crc = CONFIG_STORE_CRC_SEED;
+
+    if((NULL == record) || (NULL == data) || (ZERO_INIT == record->size) || (record->size > CONFIG_RECORD_DATA_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The newest copy is never the one written
+        l_slot = (CONFIG_RECORD_NO_SLOT == record->active_slot) ? ZERO_INIT :
+                 (uint8)((record->active_slot + 1) % CONFIG_RECORD_SLOTS_NUM);
+        l_version = (CONFIG_RECORD_NO_SLOT == record->active_slot) ? ZERO_INIT : (uint16)(record->version + 1);
+        l_copy[0] = (uint8)(l_version >> 8);
+        l_copy[1] = (uint8)l_version;
+        for(l_index = ZERO_INIT; l_index < record->size; l_index++)
+        {
+            l_copy[l_index + 2] = data[l_index];
+        }
+        l_length = (uint8)(record->size + 2);
+        for(l_index = ZERO_INIT; l_index < l_length; l_index++)
+        {
+            l_crc = config_store_crc(l_crc, l_copy[l_index]);
+        }
+        //The CRC is queued last, the copy is valid only once its last byte is written
+        l_copy[l_length] = (uint8)(l_crc >> 8);
+        l_copy[l_length + 1] = (uint8)l_crc;
+        l_length += 2;
+
+        ret = EEPROM_WriteBlock_Async(record->slot_address[l_slot], l_copy, l_length, NULL);
+        if(E_NOT_OK == ret)
+        {
+            //The queue is full, wait for room
+            ret = EEPROM_WriteBlock(record->slot_address[l_slot], l_copy, l_length);
+        }else{/* Nothing */}
+        if(E_OK == ret)
+        {
+            record->active_slot = l_slot;
+            record->version = l_version;
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Adds one byte to a CRC, bit by bit: it runs on writes and on the boot scan only.
+ * 
+ * @param crc The CRC of the previous bytes (CONFIG_STORE_CRC_SEED for the first one).
+ * @param data The byte.
+ * @return The updated CRC.
+ */
+static uint16 config_store_crc(uint16 crc, uint8 data)
+{
+    uint8 l_bit = ZERO_INIT;
+
+    crc ^= (uint16)data << 8;
+    for(l_bit = ZERO_INIT; l_bit < 8; l_bit++)
+    {
+        crc = (crc & 0x8000U) ? (uint16)((crc << 1) ^ CONFIG_STORE_CRC_POLY) : (uint16)(crc << 1);
+    }
+    return crc;
+}
+
+/**
+ * @brief Tells whether a slot holds the newest record of a key.
+ * 
+ * @param slot The slot.
+ * @return STD_HIGH if the slot is in use, STD_LOW if it may be overwritten.
+ */
+static uint8 config_store_slot_used(uint8 slot)
+{
+    uint8 l_used = STD_LOW;
+    uint8 l_key = ZERO_INIT;
+
+    for(l_key = ZERO_INIT; l_key < CONFIG_STORE_KEYS_NUM; l_key++)
+    {
+        if(slot == store_index[l_key].slot)
+        {
+            l_used = STD_HIGH;
+        }else{/* Nothing */}
+    }
+    return l_used;
+}
+
+/**
+ * @brief Writes the RAM value of a key in the next free slot of the ring and updates the index.
+ * 
+ * @param key The key.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+static Std_ReturnType config_store_append(uint8 key)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_record[CONFIG_STORE_RECORD_SIZE];
+    uint8 l_slot = store_next_slot;
+    uint16 l_sequence = store_sequence + 1;
+    uint16 value = store_index[key].value;
+    uint16 l_crc = CONFIG_STORE_CRC_SEED;
+    uint8 l_index = ZERO_INIT;
+
+    //The ring has more slots than keys, so a free one is always found
+    while(STD_HIGH == config_store_slot_used(l_slot))
+    {
+        l_slot = (uint8)((l_slot + 1) % CONFIG_STORE_RECORDS_NUM);
+    }
+    l_record[CONFIG_STORE_SEQ_HIGH] = (uint8)(l_sequence >> 8);
+    l_record[CONFIG_STORE_SEQ_LOW] = (uint8)l_sequence;
+    l_record[CONFIG_STORE_KEY] = key;
+    l_record[CONFIG_STORE_VALUE_HIGH] = (uint8)(value >> 8);
+    l_record[CONFIG_STORE_VALUE_LOW] = (uint8)value;
+    for(l_index = ZERO_INIT; l_index < CONFIG_STORE_CRC_HIGH; l_index++)
+    {
+        l_crc = config_store_crc(l_crc, l_record[l_index]);
+    }
+    l_record[CONFIG_STORE_CRC_HIGH] = (uint8)(l_crc >> 8);
+    l_record[CONFIG_STORE_CRC_LOW] = (uint8)l_crc;
+
+    ret = EEPROM_WriteBlock_Async(CONFIG_STORE_RECORD_ADDRESS(l_slot), l_record, CONFIG_STORE_RECORD_SIZE, NULL);
+    if(E_NOT_OK == ret)
+    {
+        //The queue is full, wait for room
+        ret = EEPROM_WriteBlock(CONFIG_STORE_RECORD_ADDRESS(l_slot), l_record, CONFIG_STORE_RECORD_SIZE);
+    }else{/* Nothing */}
+    if(E_OK == ret)
+    {
+        store_index[key].sequence = l_sequence;
+        store_index[key].slot = l_slot;
+        store_index[key].dirty = STD_LOW;
+        store_sequence = l_sequence;
+        store_next_slot = (uint8)((l_slot + 1) % CONFIG_STORE_RECORDS_NUM);
+        //Keys that aren't written stay in their slots while the sequence moves on, renumber them in time
+        for(l_index = ZERO_INIT; l_index < CONFIG_STORE_KEYS_NUM; l_index++)
+        {
+            if((CONFIG_STORE_NO_SLOT != store_index[l_index].slot) &&
+               ((uint16)(store_sequence - store_index[l_index].sequence) > CONFIG_STORE_SEQ_REFRESH))
+            {
+                store_index[l_index].dirty = STD_HIGH;
+            }else{/* Nothing */}
+        }
+    }else{/* Nothing */}
+    return ret;
+}
@@ -0,0 +1,163 @@
+/* 
+ * File:   config_store.h
+ * Author: Mohamed Sameh
+ * Description:
+ * Log-structured key/value store in the data EEPROM. Every write appends a record (sequence number,
+ * key, 16-bit value, CRC-16) to the next slot of a ring, so the writes of a value that changes
+ * often are spread over the whole region instead of wearing a single cell.
+ *
+ * config_store_init() scans the ring once and keeps the newest value of every key in RAM, checked
+ * against the range of the key. Reads and writes use the RAM copy only: a write marks the key and
+ * config_store_task(), called from the polling loops, appends one marked key whenever the EEPROM is
+ * idle. config_store_flush() queues all of them at once for values that can't wait. The slot holding
+ * the newest record of a key is never overwritten, so a reset in the middle of a write can only lose
+ * that write, the previous value is found at the next boot.
+ * Writing the value a key already holds doesn't append anything, and a key changed several times
+ * before the writer runs costs a single record.
+ *
+ * Values that must change together (the passwords) are kept in A/B records instead: two copies of a
+ * block, each with a version number and a CRC-16 written after the data. A commit rewrites the older
+ * copy only, so a reset leaves either the new copy complete or the previous one intact, and
+ * config_store_record_load() takes the newest copy whose CRC matches. The EEPROM driver skips the bytes
+ * the older copy already holds.
+ *
+ * Created on October 19, 2026, 4:10 PM
+ */
+
+#ifndef CONFIG_STORE_H
+#define	CONFIG_STORE_H
+
+/* Section : Includes */
+#include "../../MCAL/std_types.h"
+#include "../../MCAL/EEPROM/eeprom.h"
+#include "config_store_cfg.h"
+
+/* Section : Macro Declarations */
+//Record layout, the sequence number, the value and the CRC are stored high byte first
+#define CONFIG_STORE_RECORD_SIZE    7U
+#define CONFIG_STORE_SEQ_HIGH       (uint8)0
+#define CONFIG_STORE_SEQ_LOW        (uint8)1
+#define CONFIG_STORE_KEY            (uint8)2
+#define CONFIG_STORE_VALUE_HIGH     (uint8)3
+#define CONFIG_STORE_VALUE_LOW      (uint8)4
+#define CONFIG_STORE_CRC_HIGH       (uint8)5
+#define CONFIG_STORE_CRC_LOW        (uint8)6
+#define CONFIG_STORE_CRC_POLY       (uint16)0x1021  // CRC-16/CCITT
+
+/* The newest record is found by comparing sequence numbers modulo 2^16, which holds while all the
+   records are less than 2^15 writes apart: a record older than this is rewritten with a new number */
+#define CONFIG_STORE_SEQ_REFRESH    (uint16)0x4000
+
+//A/B record layout: version (high byte first), data, CRC of the version and the data (high byte first)
+#define CONFIG_RECORD_SLOTS_NUM     2U
+#define CONFIG_RECORD_NO_SLOT       (uint8)0xFF
+#define CONFIG_RECORD_OVERHEAD      4U
+//A copy is queued in one request to the EEPROM driver
+#define CONFIG_RECORD_DATA_MAX      (uint8)(EEPROM_QUEUE_SIZE - CONFIG_RECORD_OVERHEAD)
+
+#if (CONFIG_STORE_RECORDS_NUM <= CONFIG_STORE_KEYS_NUM) || (CONFIG_STORE_RECORDS_NUM > 255U)
+#error "config_store: the ring needs a free slot besides the newest record of every key"
+#endif
+#if (CONFIG_STORE_START_ADDRESS + (CONFIG_STORE_RECORDS_NUM * CONFIG_STORE_RECORD_SIZE)) > EEPROM_SIZE
+#error "config_store: the ring doesn't fit in the data EEPROM"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+/* Default value and range of a key */
+typedef struct
+{
+    uint16 default_value;       // Value of a key never written or holding a value out of range
+    uint16 min;
+    uint16 max;
+}config_store_field_t;
+
+typedef struct
+{
+    uint16 slot_address[CONFIG_RECORD_SLOTS_NUM];   // EEPROM address of the A and B copies
+    uint8 size;                                     // Data bytes (1 .. CONFIG_RECORD_DATA_MAX)
+    uint16 version;                                 // Version of the newest copy, kept by the functions
+    uint8 active_slot;                              // Newest valid copy, CONFIG_RECORD_NO_SLOT if none
+}config_record_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Scans the ring and builds the RAM copy of every key, keys never written or holding
+ *        a value out of their range take their default value. Call it once after EEPROM_Init().
+ * 
+ * @param fields The default value and the range of every key (CONFIG_STORE_KEYS_NUM entries).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_init(const config_store_field_t *fields);
+
+/**
+ * @brief Reads the value of a key from RAM.
+ * 
+ * @param key The key (0 .. CONFIG_STORE_KEYS_NUM - 1).
+ * @param value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_read(uint8 key, uint16 *value);
+
+/**
+ * @brief Sets the value of a key in RAM and marks it to be written by config_store_task().
+ *        No EEPROM access is done.
+ * 
+ * @param key The key (0 .. CONFIG_STORE_KEYS_NUM - 1).
+ * @param value The value, in the range of the key.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong key or value out of range, nothing is changed.
+ */
+Std_ReturnType config_store_write(uint8 key, uint16 value);
+
+/**
+ * @brief Background writer: queues the record of one marked key when the EEPROM is idle.
+ *        Call it from the polling loops, it returns at once.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_task(void);
+
+/**
+ * @brief Queues the records of all the marked keys now, for values that must survive a reset
+ *        that may come before the next config_store_task(). It doesn't wait for the writes.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_flush(void);
+
+/**
+ * @brief Finds the newest copy of an A/B record whose CRC matches and reads its data.
+ *        Call it once after EEPROM_Init(), before the first commit.
+ * 
+ * @param record A pointer to the record (slot addresses and size set).
+ * @param data A pointer to store the data (size bytes).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong parameters or no valid copy, data is left unchanged.
+ */
+Std_ReturnType config_store_record_load(config_record_t *record, uint8 *data);
+
+/**
+ * @brief Writes the data with the next version over the older copy of an A/B record.
+ *        The write runs in the background, the newest copy stays valid until it's complete.
+ * 
+ * @param record A pointer to the record.
+ * @param data The data (size bytes), it's copied so it may change after the call.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType config_store_record_commit(config_record_t *record, const uint8 *data);
+
+#endif	/* CONFIG_STORE_H */
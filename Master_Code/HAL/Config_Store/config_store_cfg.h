@@ -0,0 +1,25 @@
+/* 
+ * File:   config_store_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:10 PM
+ */
+
+#ifndef CONFIG_STORE_CFG_H
+#define	CONFIG_STORE_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define CONFIG_STORE_START_ADDRESS  0x100U          // First byte of the region reserved for the store
+#define CONFIG_STORE_RECORDS_NUM    40U             // Records in the ring (7 bytes each, 280 bytes)
+#define CONFIG_STORE_KEYS_NUM       8U              // Keys 0 .. CONFIG_STORE_KEYS_NUM - 1
+#define CONFIG_STORE_CRC_SEED       (uint16)0x1D0F  // An erased (0xFF) or cleared (0x00) record fails the CRC
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* CONFIG_STORE_CFG_H */
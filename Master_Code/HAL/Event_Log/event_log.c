@@ -0,0 +1,181 @@
+/* 
+ * File:   event_log.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 7:20 PM
+ */
+
+#include "event_log.h"
+
+#define EVENT_LOG_RECORD_ADDRESS(slot)  (uint16)(EVENT_LOG_START_ADDRESS + ((uint16)(slot) * EVENT_LOG_RECORD_SIZE))
+//The last byte of a record holds bits 31..24
+#define EVENT_LOG_TOP_BYTE              (uint8)(EVENT_LOG_RECORD_SIZE - 1)
+
+static uint8 log_head = ZERO_INIT;     // Slot of the next event
+static uint8 log_count = ZERO_INIT;    // Events in the ring
+static uint8 log_lap = ZERO_INIT;      // Lap bit of the events written in this pass
+
+/**
+ * @brief Finds the end of the log, only the last byte of every record is read.
+ *        Call it once after EEPROM_Init().
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_init(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_top = ZERO_INIT, l_first_lap = ZERO_INIT, l_slot = ZERO_INIT;
+
+    log_head = ZERO_INIT;
+    log_count = ZERO_INIT;
+    log_lap = ZERO_INIT;
+    ret = EEPROM_ReadByte(EVENT_LOG_RECORD_ADDRESS(ZERO_INIT) + EVENT_LOG_TOP_BYTE, &l_top);
+    if((E_OK == ret) && (EVENT_LOG_EMPTY != ((l_top >> (EVENT_LOG_EVENT_SHIFT - 24U)) & EVENT_LOG_EVENT_MASK)))
+    {
+        //The events of the current pass have the lap of slot 0, the end is the first slot without it
+        l_first_lap = (uint8)(l_top >> (EVENT_LOG_LAP_SHIFT - 24U));
+        log_lap = l_first_lap;
+        for(l_slot = 1; (l_slot < EVENT_LOG_RECORDS_NUM) && (E_OK == ret); l_slot++)
+        {
+            ret = EEPROM_ReadByte(EVENT_LOG_RECORD_ADDRESS(l_slot) + EVENT_LOG_TOP_BYTE, &l_top);
+            if((EVENT_LOG_EMPTY == ((l_top >> (EVENT_LOG_EVENT_SHIFT - 24U)) & EVENT_LOG_EVENT_MASK)) ||
+               (l_first_lap != (uint8)(l_top >> (EVENT_LOG_LAP_SHIFT - 24U))))
+            {
+                break;
+            }else{/* Nothing */}
+        }
+        if(EVENT_LOG_RECORDS_NUM == l_slot)
+        {
+            //The pass ended on the last slot, the next event starts a new lap
+            log_head = ZERO_INIT;
+            log_lap ^= 1U;
+            log_count = EVENT_LOG_RECORDS_NUM;
+        }
+        else
+        {
+            log_head = l_slot;
+            //Past the end there are either erased slots (first pass) or the previous lap
+            log_count = (EVENT_LOG_EMPTY == ((l_top >> (EVENT_LOG_EVENT_SHIFT - 24U)) & EVENT_LOG_EVENT_MASK)) ?
+                        l_slot : EVENT_LOG_RECORDS_NUM;
+        }
+    }else{/* Nothing, the log is empty */}
+    return ret;
+}
+
+/**
+ * @brief Appends an event, the oldest one is overwritten when the log is full.
+ *        The record is written in the background by the EEPROM queue.
+ * 
+ * @param entry A pointer to the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_add(const event_log_entry_t *entry)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_record[EVENT_LOG_RECORD_SIZE];
+    uint8 l_index = ZERO_INIT;
+    uint32 l_packed = ZERO_INIT;
+
+    if((NULL == entry) || (entry->event >= EVENT_LOG_EMPTY) ||
+       (entry->user > EVENT_LOG_USER_MASK) || (entry->device > EVENT_LOG_DEVICE_MASK))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_packed = ((uint32)log_lap << EVENT_LOG_LAP_SHIFT) |
+                   ((uint32)entry->event << EVENT_LOG_EVENT_SHIFT) |
+                   ((uint32)entry->user << EVENT_LOG_USER_SHIFT) |
+                   ((uint32)entry->device << EVENT_LOG_DEVICE_SHIFT) |
+                   ((entry->time > EVENT_LOG_TIME_MAX) ? EVENT_LOG_TIME_MAX : entry->time);
+        //Low byte first, the queue writes the byte with the lap last
+        for(l_index = ZERO_INIT; l_index < EVENT_LOG_RECORD_SIZE; l_index++)
+        {
+            l_record[l_index] = (uint8)(l_packed >> (8U * l_index));
+        }
+        ret = EEPROM_WriteBlock_Async(EVENT_LOG_RECORD_ADDRESS(log_head), l_record, EVENT_LOG_RECORD_SIZE, NULL);
+        if(E_NOT_OK == ret)
+        {
+            //The queue is full, wait for room
+            ret = EEPROM_WriteBlock(EVENT_LOG_RECORD_ADDRESS(log_head), l_record, EVENT_LOG_RECORD_SIZE);
+        }else{/* Nothing */}
+        if(E_OK == ret)
+        {
+            log_head++;
+            if(EVENT_LOG_RECORDS_NUM == log_head)
+            {
+                log_head = ZERO_INIT;
+                log_lap ^= 1U;
+            }else{/* Nothing */}
+            if(log_count < EVENT_LOG_RECORDS_NUM)
+            {
+                log_count++;
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the number of events in the log.
+ * 
+ * @param count A pointer to store the number of events.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_get_count(uint8 *count)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *count = log_count;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads an event.
+ * 
+ * @param age 0 for the newest event, count - 1 for the oldest one.
+ * @param entry A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or no such event).
+ */
+Std_ReturnType event_log_read(uint8 age, event_log_entry_t *entry)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_record[EVENT_LOG_RECORD_SIZE];
+    uint8 l_slot = ZERO_INIT, l_index = ZERO_INIT;
+    uint32 l_packed = ZERO_INIT;
+
+    if((NULL == entry) || (age >= log_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_slot = (uint8)(((uint16)log_head + EVENT_LOG_RECORDS_NUM - 1 - age) % EVENT_LOG_RECORDS_NUM);
+        //Reads the queued bytes too, an event still being written reads as written
+        ret = EEPROM_ReadBlock(EVENT_LOG_RECORD_ADDRESS(l_slot), l_record, EVENT_LOG_RECORD_SIZE);
+        for(l_index = ZERO_INIT; l_index < EVENT_LOG_RECORD_SIZE; l_index++)
+        {
+            l_packed |= (uint32)l_record[l_index] << (8U * l_index);
+        }
+        entry->time = l_packed & EVENT_LOG_TIME_MAX;
+        entry->event = (uint8)(l_packed >> EVENT_LOG_EVENT_SHIFT) & EVENT_LOG_EVENT_MASK;
+        entry->user = (uint8)(l_packed >> EVENT_LOG_USER_SHIFT) & EVENT_LOG_USER_MASK;
+        entry->device = (uint8)(l_packed >> EVENT_LOG_DEVICE_SHIFT) & EVENT_LOG_DEVICE_MASK;
+    }
+    return ret;
+}
@@ -0,0 +1,101 @@
+/* 
+ * File:   event_log.h
+ * Author: Mohamed Sameh
+ * Description:
+ * Append-only event log in a ring of 32-bit records of the data EEPROM:
+ *   bit  31     lap, flips every time the ring wraps
+ *   bits 30..27 event (EVENT_LOG_EMPTY marks an erased record)
+ *   bits 26..25 user mode
+ *   bits 24..22 device
+ *   bits 21..0  time in seconds, saturated at EVENT_LOG_TIME_MAX
+ * A record is one request to the EEPROM queue and the log keeps no index in the EEPROM, so an event
+ * costs one background write of 4 bytes, spread over the ring. The record is stored low byte first:
+ * the byte holding the lap and the event is written last, a record torn by a reset still reads as
+ * the record of the previous lap (or as empty), so event_log_init() finds the same end of the log.
+ *
+ * Created on October 19, 2026, 7:20 PM
+ */
+
+#ifndef EVENT_LOG_H
+#define	EVENT_LOG_H
+
+/* Section : Includes */
+#include "../../MCAL/std_types.h"
+#include "../../MCAL/EEPROM/eeprom.h"
+#include "event_log_cfg.h"
+
+/* Section : Macro Declarations */
+#define EVENT_LOG_RECORD_SIZE       4U
+#define EVENT_LOG_LAP_SHIFT         31U
+#define EVENT_LOG_EVENT_SHIFT       27U
+#define EVENT_LOG_USER_SHIFT        25U
+#define EVENT_LOG_DEVICE_SHIFT      22U
+#define EVENT_LOG_EVENT_MASK        (uint8)0x0F
+#define EVENT_LOG_USER_MASK         (uint8)0x03
+#define EVENT_LOG_DEVICE_MASK       (uint8)0x07
+#define EVENT_LOG_TIME_MAX          (uint32)0x003FFFFFUL
+
+#define EVENT_LOG_EMPTY             (uint8)0x0F
+
+#if (EVENT_LOG_RECORDS_NUM < 2U) || (EVENT_LOG_RECORDS_NUM > 255U)
+#error "event_log: the ring holds 2 .. 255 records"
+#endif
+#if (EVENT_LOG_START_ADDRESS + (EVENT_LOG_RECORDS_NUM * EVENT_LOG_RECORD_SIZE)) > EEPROM_SIZE
+#error "event_log: the ring doesn't fit in the data EEPROM"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    uint32 time;                // Seconds, only the low 22 bits are kept
+    uint8 event;                // 0 .. EVENT_LOG_EMPTY - 1
+    uint8 user;                 // 0 .. 3
+    uint8 device;               // 0 .. 7
+}event_log_entry_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Finds the end of the log, only the last byte of every record is read.
+ *        Call it once after EEPROM_Init().
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_init(void);
+
+/**
+ * @brief Appends an event, the oldest one is overwritten when the log is full.
+ *        The record is written in the background by the EEPROM queue.
+ * 
+ * @param entry A pointer to the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_add(const event_log_entry_t *entry);
+
+/**
+ * @brief Reads the number of events in the log.
+ * 
+ * @param count A pointer to store the number of events.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType event_log_get_count(uint8 *count);
+
+/**
+ * @brief Reads an event.
+ * 
+ * @param age 0 for the newest event, count - 1 for the oldest one.
+ * @param entry A pointer to store the event.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or no such event).
+ */
+Std_ReturnType event_log_read(uint8 age, event_log_entry_t *entry);
+
+#endif	/* EVENT_LOG_H */
@@ -0,0 +1,23 @@
+/* 
+ * File:   event_log_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 7:20 PM
+ */
+
+#ifndef EVENT_LOG_CFG_H
+#define	EVENT_LOG_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define EVENT_LOG_START_ADDRESS     0x220U  // First byte of the region reserved for the log
+#define EVENT_LOG_RECORDS_NUM       120U    // Records in the ring (4 bytes each, up to the end of the EEPROM)
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* EVENT_LOG_CFG_H */
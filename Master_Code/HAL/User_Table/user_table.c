@@ -0,0 +1,382 @@
+/* 
+ * File:   user_table.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:05 PM
+ */
+
+#include "user_table.h"
+
+#define USER_RECORD_ADDRESS(index, slot)    (uint16)(USER_TABLE_START_ADDRESS + \
+                                            ((((uint16)(index) * CONFIG_RECORD_SLOTS_NUM) + (slot)) * USER_RECORD_COPY_SIZE))
+//The version comes first in a copy, the info byte follows it
+#define USER_RECORD_COPY_INFO               (uint8)2
+
+//Permutation of 0 .. 255 of the Pearson hashing, in program memory
+static const uint8 pearson_table[256] =
+{
+    0xD7, 0x24, 0x20, 0xCB, 0x87, 0xDD, 0xCE, 0x7B, 0xCC, 0x6A, 0xEE, 0x37, 0x9F, 0x77, 0x7D, 0x47,
+    0x4F, 0xF8, 0xB5, 0xDE, 0x2F, 0xC7, 0x43, 0x10, 0x8F, 0x6C, 0xD9, 0xBC, 0xC2, 0xB4, 0x95, 0x0C,
+    0x64, 0x93, 0x69, 0x97, 0x51, 0x25, 0x04, 0x72, 0x0F, 0x4E, 0x07, 0x23, 0xD4, 0x44, 0x7F, 0xE2,
+    0xB0, 0x39, 0xCF, 0xC6, 0x53, 0xC0, 0x09, 0xA7, 0xF0, 0xE7, 0xD5, 0x82, 0xB9, 0xAD, 0xC3, 0xAA,
+    0x2D, 0x41, 0x0D, 0xBA, 0x17, 0x3E, 0x3D, 0xCD, 0x2B, 0x9B, 0x63, 0xD3, 0x1A, 0x38, 0xB1, 0x11,
+    0xAF, 0xBB, 0xA4, 0x1D, 0x3B, 0x8B, 0x28, 0x31, 0xF6, 0x6B, 0xE3, 0xA6, 0xB2, 0x74, 0xEF, 0x70,
+    0xA3, 0x21, 0x4C, 0xFE, 0x50, 0x6D, 0x1E, 0x5C, 0x35, 0xA8, 0x03, 0xF4, 0x34, 0x84, 0x8A, 0x45,
+    0x88, 0x29, 0xC9, 0xA9, 0xA2, 0x91, 0x68, 0x42, 0x1B, 0x13, 0xD2, 0xBF, 0x0A, 0x90, 0xF1, 0x80,
+    0xDC, 0x96, 0xA1, 0xF2, 0xE9, 0x9D, 0x8D, 0x94, 0xF5, 0x85, 0x36, 0xB6, 0xED, 0x59, 0x08, 0x98,
+    0x33, 0x81, 0xFC, 0xE8, 0x9A, 0x00, 0x4B, 0x9C, 0xD0, 0xB7, 0x54, 0x30, 0xF3, 0xC1, 0x73, 0x5E,
+    0x01, 0x7E, 0x5F, 0x19, 0xD6, 0xDB, 0x57, 0xE0, 0x3A, 0x6F, 0x18, 0x5D, 0x27, 0x71, 0x2E, 0x3F,
+    0xEA, 0xD1, 0xE1, 0xFB, 0x86, 0xBE, 0xEB, 0x0B, 0xBD, 0x65, 0x15, 0xF7, 0x62, 0xAE, 0xFA, 0xAB,
+    0x32, 0x12, 0x56, 0xCA, 0xE4, 0x49, 0xC8, 0x26, 0x0E, 0x7C, 0x1C, 0x48, 0x52, 0x79, 0x6E, 0xB3,
+    0x7A, 0x16, 0xFD, 0x5B, 0x22, 0xEC, 0x05, 0xAC, 0x9E, 0x8C, 0xDA, 0xA5, 0x02, 0xFF, 0x78, 0x67,
+    0x75, 0x76, 0xF9, 0x2A, 0x83, 0x8E, 0x99, 0x66, 0x92, 0x58, 0x89, 0x1F, 0x60, 0x5A, 0xA0, 0xB8,
+    0xDF, 0x4D, 0xD8, 0xE6, 0xE5, 0x55, 0x06, 0xC4, 0xC5, 0x4A, 0x3C, 0x40, 0x46, 0x61, 0x2C, 0x14
+};
+
+static config_record_t users_record[USER_TABLE_USERS_NUM];
+static uint8 users_data[USER_TABLE_USERS_NUM][USER_RECORD_SIZE];     // Packed records, the RAM copy of the table
+
+static uint8 user_table_record_valid(const uint8 *data);
+static void user_table_clear(uint8 *data);
+static void user_table_hash(const uint8 *pin, uint8 length, uint8 salt, uint8 *digest);
+static Std_ReturnType user_table_commit(uint8 index, uint8 info, uint8 timeout, const uint8 *pin, uint8 salt);
+
+/**
+ * @brief Reads every user of the table, a user without a valid copy or with a bad
+ *        record is a free entry. A user whose PIN is still in clear is hashed and rewritten
+ *        to both copies, an older copy still holding a PIN in clear is overwritten.
+ *        Call it once after config_store_init().
+ * 
+ * @param seed A value that changes from boot to boot, the salts of the rewritten users are made from it.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_init(uint8 seed)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT, l_key = ZERO_INIT, l_info = ZERO_INIT;
+    uint8 l_pin[USER_PIN_MAX];
+    uint8 *l_data = NULL;
+
+    for(l_index = ZERO_INIT; l_index < USER_TABLE_USERS_NUM; l_index++)
+    {
+        l_data = users_data[l_index];
+        users_record[l_index].slot_address[0] = USER_RECORD_ADDRESS(l_index, 0);
+        users_record[l_index].slot_address[1] = USER_RECORD_ADDRESS(l_index, 1);
+        users_record[l_index].size = USER_RECORD_SIZE;
+        user_table_clear(l_data);
+        //A user never written has no valid copy and stays free
+        if((E_OK == config_store_record_load(&users_record[l_index], l_data)) &&
+           (STD_LOW == user_table_record_valid(l_data)))
+        {
+            user_table_clear(l_data);
+        }
+        else if((ZERO_INIT != l_data[USER_RECORD_INFO]) && (ZERO_INIT == (l_data[USER_RECORD_INFO] & USER_RECORD_HASHED)))
+        {
+            //The previous version kept the key codes in clear, one per nibble, the first key in the high nibble
+            for(l_key = ZERO_INIT; l_key < USER_PIN_MAX; l_key++)
+            {
+                l_pin[l_key] = (l_key & 1U) ? (l_data[USER_RECORD_PIN + (l_key >> 1)] & 0x0F) :
+                                             (uint8)(l_data[USER_RECORD_PIN + (l_key >> 1)] >> 4);
+            }
+            //The user is rewritten on its own A/B record, a reset keeps the clear copy till the next boot
+            ret = user_table_commit(l_index, l_data[USER_RECORD_INFO], l_data[USER_RECORD_TIMEOUT], l_pin, (uint8)(seed + l_index));
+            if(E_OK == ret)
+            {
+                //A commit replaces the older copy only, the other one still holds the PIN in clear
+                ret = config_store_record_commit(&users_record[l_index], l_data);
+            }else{/* Nothing */}
+            for(l_key = ZERO_INIT; l_key < USER_PIN_MAX; l_key++)
+            {
+                l_pin[l_key] = ZERO_INIT;
+            }
+        }
+        else if(CONFIG_RECORD_NO_SLOT != users_record[l_index].active_slot)
+        {
+            //A reset between the two commits of the migration, or a removal by the previous version,
+            //leaves a PIN in clear in the older copy: the newest record is written over it
+            ret = EEPROM_ReadByte(users_record[l_index].slot_address[(users_record[l_index].active_slot + 1U) % CONFIG_RECORD_SLOTS_NUM] +
+                                  USER_RECORD_COPY_INFO, &l_info);
+            if((E_OK == ret) && (ZERO_INIT != l_info) && (ZERO_INIT == (l_info & USER_RECORD_HASHED)))
+            {
+                ret = config_store_record_commit(&users_record[l_index], l_data);
+            }else{/* Nothing */}
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a user from RAM.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param user A pointer to store the user, its role is USER_ROLE_NONE for a free entry.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_get(uint8 index, user_entry_t *user)
+{
+    Std_ReturnType ret = E_OK;
+
+    if((index >= USER_TABLE_USERS_NUM) || (NULL == user))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        user->role = (uint8)(users_data[index][USER_RECORD_INFO] >> USER_RECORD_ROLE_SHIFT) & USER_RECORD_ROLE_MASK;
+        user->pin_length = users_data[index][USER_RECORD_INFO] & USER_RECORD_LENGTH_MASK;
+        user->timeout = users_data[index][USER_RECORD_TIMEOUT];
+    }
+    return ret;
+}
+
+/**
+ * @brief Adds a user or replaces it, the record is written in the background.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param user A pointer to the user.
+ * @param pin The key codes of the PIN (user->pin_length of them, 0 .. USER_PIN_CODES_NUM - 1).
+ * @param salt A value that should differ from the previous salts, a timer reading will do.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong index or user out of range, nothing is changed.
+ */
+Std_ReturnType user_table_set(uint8 index, const user_entry_t *user, const uint8 *pin, uint8 salt)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_key = ZERO_INIT;
+
+    if((index >= USER_TABLE_USERS_NUM) || (NULL == user) || (NULL == pin) ||
+       (USER_ROLE_NONE == user->role) || (user->role > USER_ROLE_GUEST) ||
+       (user->pin_length < USER_PIN_MIN) || (user->pin_length > USER_PIN_MAX) || (user->timeout < USER_TIMEOUT_MIN))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_key = ZERO_INIT; l_key < user->pin_length; l_key++)
+        {
+            if(pin[l_key] >= USER_PIN_CODES_NUM)
+            {
+                ret = E_NOT_OK;
+            }else{/* Nothing */}
+        }
+        if(E_OK == ret)
+        {
+            ret = user_table_commit(index, (uint8)((user->role << USER_RECORD_ROLE_SHIFT) | user->pin_length),
+                                    user->timeout, pin, salt);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Removes a user, the record is written in the background.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_remove(uint8 index)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_data[USER_RECORD_SIZE];
+
+    if(index >= USER_TABLE_USERS_NUM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //A free entry is committed like any change, so a reset can't bring the user back half removed
+        user_table_clear(l_data);
+        ret = config_store_record_commit(&users_record[index], l_data);
+        if(E_OK == ret)
+        {
+            user_table_clear(users_data[index]);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Counts the users of a role.
+ * 
+ * @param role The role (USER_ROLE_NONE counts the free entries).
+ * @param count A pointer to store the number of users.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_count(uint8 role, uint8 *count)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *count = ZERO_INIT;
+        for(l_index = ZERO_INIT; l_index < USER_TABLE_USERS_NUM; l_index++)
+        {
+            if(role == ((uint8)(users_data[l_index][USER_RECORD_INFO] >> USER_RECORD_ROLE_SHIFT) & USER_RECORD_ROLE_MASK))
+            {
+                (*count)++;
+            }else{/* Nothing */}
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Checks a PIN against the digest of a user, in the time of one hash (USER_HASH_CYCLES
+ *        at most) whatever the PIN, the user or the position of the first wrong key.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param pin The key codes of the entered PIN.
+ * @param length The number of keys entered.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The PIN is the one of the user.
+ *         - E_NOT_OK: Wrong PIN, free entry or wrong parameters.
+ */
+Std_ReturnType user_table_check_pin(uint8 index, const uint8 *pin, uint8 length)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_digest[USER_DIGEST_SIZE];
+    uint8 l_byte = ZERO_INIT, l_diff = ZERO_INIT;
+
+    if((index < USER_TABLE_USERS_NUM) && (NULL != pin) && (length <= USER_PIN_MAX))
+    {
+        //The hash runs for a free entry or a wrong length too, every byte is compared, no early exit
+        user_table_hash(pin, length, users_data[index][USER_RECORD_SALT], l_digest);
+        l_diff = (uint8)((users_data[index][USER_RECORD_INFO] & USER_RECORD_LENGTH_MASK) ^ length);
+        l_diff |= (uint8)((users_data[index][USER_RECORD_INFO] & USER_RECORD_HASHED) ^ USER_RECORD_HASHED);
+        for(l_byte = ZERO_INIT; l_byte < USER_DIGEST_SIZE; l_byte++)
+        {
+            l_diff |= (uint8)(l_digest[l_byte] ^ users_data[index][USER_RECORD_DIGEST + l_byte]);
+        }
+        ret = (ZERO_INIT == l_diff) ? E_OK : E_NOT_OK;
+    }else{/* Nothing */}
+    return ret;
+}
+
+/**
+ * @brief Checks the fields of a packed record, a free entry is valid.
+ * 
+ * @param data The packed record.
+ * @return STD_HIGH if the record can be used, STD_LOW if not.
+ */
+static uint8 user_table_record_valid(const uint8 *data)
+{
+    uint8 l_role = (uint8)(data[USER_RECORD_INFO] >> USER_RECORD_ROLE_SHIFT) & USER_RECORD_ROLE_MASK;
+    uint8 l_length = data[USER_RECORD_INFO] & USER_RECORD_LENGTH_MASK;
+    uint8 l_valid = STD_HIGH;
+
+    if(USER_ROLE_NONE == l_role)
+    {
+        l_valid = (ZERO_INIT == data[USER_RECORD_INFO]) ? STD_HIGH : STD_LOW;
+    }
+    else if((l_role > USER_ROLE_GUEST) || (l_length < USER_PIN_MIN) || (l_length > USER_PIN_MAX) ||
+            (data[USER_RECORD_TIMEOUT] < USER_TIMEOUT_MIN))
+    {
+        l_valid = STD_LOW;
+    }else{/* Nothing */}
+    return l_valid;
+}
+
+/**
+ * @brief Fills a packed record with a free entry.
+ * 
+ * @param data The packed record.
+ */
+static void user_table_clear(uint8 *data)
+{
+    uint8 l_byte = ZERO_INIT;
+
+    for(l_byte = ZERO_INIT; l_byte < USER_RECORD_SIZE; l_byte++)
+    {
+        data[l_byte] = ZERO_INIT;
+    }
+}
+
+/**
+ * @brief Computes the digest of a salted PIN. The number of lookups depends on the length only:
+ *        USER_HASH_ROUNDS * USER_DIGEST_SIZE * (length + 4).
+ * 
+ * @param pin The key codes of the PIN.
+ * @param length The number of keys.
+ * @param salt The salt of the user.
+ * @param digest A pointer to store the USER_DIGEST_SIZE bytes of the digest.
+ */
+static void user_table_hash(const uint8 *pin, uint8 length, uint8 salt, uint8 *digest)
+{
+    uint8 l_round = ZERO_INIT, l_lane = ZERO_INIT, l_key = ZERO_INIT;
+    uint8 l_hash = ZERO_INIT, l_next = ZERO_INIT;
+
+    for(l_lane = ZERO_INIT; l_lane < USER_DIGEST_SIZE; l_lane++)
+    {
+        digest[l_lane] = l_lane;//every lane starts from another value, so the lanes differ
+    }
+    for(l_round = ZERO_INIT; l_round < USER_HASH_ROUNDS; l_round++)
+    {
+        for(l_lane = ZERO_INIT; l_lane < USER_DIGEST_SIZE; l_lane++)
+        {
+            l_hash = pearson_table[(uint8)(digest[l_lane] ^ l_round)];
+            l_hash = pearson_table[(uint8)(l_hash ^ salt)];
+            l_hash = pearson_table[(uint8)(l_hash ^ length)];
+            for(l_key = ZERO_INIT; l_key < length; l_key++)
+            {
+                l_hash = pearson_table[(uint8)(l_hash ^ pin[l_key])];
+            }
+            //the next lane is mixed in, a round depends on all of them (no % here, it calls the library division)
+            l_next = (uint8)(l_lane + 1U);
+            if(l_next >= USER_DIGEST_SIZE)
+            {
+                l_next = ZERO_INIT;
+            }else{/* Nothing */}
+            l_hash = pearson_table[(uint8)(l_hash ^ digest[l_next])];
+            digest[l_lane] = l_hash;
+        }
+    }
+}
+
+/**
+ * @brief Hashes the PIN of a user and commits its record, the RAM copy follows once the
+ *        write is queued.
+ * 
+ * @param index The user.
+ * @param info The role and the PIN length, the hashed flag is added.
+ * @param timeout The session timeout.
+ * @param pin The key codes of the PIN.
+ * @param salt The salt of the new digest.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+static Std_ReturnType user_table_commit(uint8 index, uint8 info, uint8 timeout, const uint8 *pin, uint8 salt)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_data[USER_RECORD_SIZE];
+    uint8 l_byte = ZERO_INIT;
+
+    l_data[USER_RECORD_INFO] = (uint8)(info | USER_RECORD_HASHED);
+    l_data[USER_RECORD_TIMEOUT] = timeout;
+    l_data[USER_RECORD_SALT] = salt;
+    user_table_hash(pin, info & USER_RECORD_LENGTH_MASK, salt, &l_data[USER_RECORD_DIGEST]);
+    ret = config_store_record_commit(&users_record[index], l_data);
+    if(E_OK == ret)
+    {
+        for(l_byte = ZERO_INIT; l_byte < USER_RECORD_SIZE; l_byte++)
+        {
+            users_data[index][l_byte] = l_data[l_byte];
+        }
+    }else{/* Nothing */}
+    return ret;
+}
@@ -0,0 +1,161 @@
+/* 
+ * File:   user_table.h
+ * Author: Mohamed Sameh
+ * Description:
+ * Table of the users allowed to log in. Every user has a role, a PIN of USER_PIN_MIN .. USER_PIN_MAX
+ * keys and a session timeout, packed in 6 bytes:
+ *   byte 0     hashed flag (bit 7), role (bits 5..4) and PIN length (bits 3..0)
+ *   byte 1     session timeout in seconds
+ *   byte 2     salt
+ *   bytes 3..5 digest of the salt and the PIN
+ * Every user is an A/B record of the configuration store, so adding, changing or removing one user
+ * rewrites that user only and a reset in the middle leaves the user as it was. The table is read
+ * once by user_table_init(), a user is then found by its index without any EEPROM access.
+ *
+ * The PIN is never stored, only a 24-bit digest: three lanes of Pearson hashing (one table lookup
+ * per byte, made for 8-bit cores) run USER_HASH_ROUNDS times over the salt, the PIN and the other
+ * lanes. It isn't a cryptographic hash, it keeps the PIN out of the EEPROM and makes every guess
+ * against a dumped table cost the same rounds as a login. A check always runs all the rounds and
+ * compares all the digest bytes, its time doesn't depend on the PIN or on the stored digest.
+ * A record of the previous version, holding the PIN keys in clear (hashed flag clear), is hashed
+ * and rewritten to both A/B copies by user_table_init(), so no copy keeps the PIN in clear.
+ *
+ * Created on October 19, 2026, 9:05 PM
+ */
+
+#ifndef USER_TABLE_H
+#define	USER_TABLE_H
+
+/* Section : Includes */
+#include "../../MCAL/std_types.h"
+#include "../../MCAL/device_config.h"
+#include "../Config_Store/config_store.h"
+#include "user_table_cfg.h"
+
+/* Section : Macro Declarations */
+#define USER_ROLE_NONE              (uint8)0    // Free entry
+#define USER_ROLE_ADMIN             (uint8)1
+#define USER_ROLE_GUEST             (uint8)2
+
+#define USER_PIN_MIN                (uint8)4
+#define USER_PIN_MAX                8U
+#define USER_PIN_CODES_NUM          (uint8)16   // A key of the PIN is given as a code 0 .. 15
+#define USER_TIMEOUT_MIN            (uint8)10   // Shortest session timeout in seconds
+
+//Record layout
+#define USER_RECORD_SIZE            6U
+#define USER_RECORD_INFO            (uint8)0
+#define USER_RECORD_TIMEOUT         (uint8)1
+#define USER_RECORD_SALT            (uint8)2
+#define USER_RECORD_DIGEST          (uint8)3
+#define USER_RECORD_PIN             (uint8)2    // First byte of the PIN of a record in clear
+#define USER_RECORD_HASHED          (uint8)0x80
+#define USER_RECORD_ROLE_SHIFT      4U
+#define USER_RECORD_ROLE_MASK       (uint8)0x03
+#define USER_RECORD_LENGTH_MASK     (uint8)0x0F
+#define USER_DIGEST_SIZE            3U
+//Every user takes two copies of the record, each with the version and the CRC of the A/B records
+#define USER_RECORD_COPY_SIZE       (USER_RECORD_SIZE + CONFIG_RECORD_OVERHEAD)
+
+/* Cost of one hash: every round looks the table up USER_PIN_MAX + 4 times per lane at most.
+   USER_HASH_LOOKUP_CYCLES is an estimate, not measured on the target: user_table_hash_test.py
+   counts the lookups of each line with gcov and weights them with the PIC18 instructions of the
+   line (FSR index, XOR, TBLRD from program memory, store, loop step). A hash of 8 keys models at
+   about 32000 instruction cycles for 1440 lookups, 22.2 per lookup, 32 ms at 4 MHz */
+#define USER_HASH_LOOKUP_CYCLES     23UL
+#define USER_HASH_LOOKUPS           (USER_HASH_ROUNDS * USER_DIGEST_SIZE * (USER_PIN_MAX + 4U))
+#define USER_HASH_CYCLES            (USER_HASH_LOOKUPS * USER_HASH_LOOKUP_CYCLES)
+
+#if (USER_TABLE_USERS_NUM < 1U) || (USER_TABLE_USERS_NUM > 10U)
+#error "user_table: the table holds 1 .. 10 users"
+#endif
+#if (USER_TABLE_START_ADDRESS + (USER_TABLE_USERS_NUM * CONFIG_RECORD_SLOTS_NUM * USER_RECORD_COPY_SIZE)) > CONFIG_STORE_START_ADDRESS
+#error "user_table: the table overlaps the ring of the configuration store"
+#endif
+#if USER_HASH_CYCLES > ((_XTAL_FREQ / 4000UL) * USER_HASH_BUDGET_MS)
+#error "user_table: the PIN hash doesn't fit in USER_HASH_BUDGET_MS, lower USER_HASH_ROUNDS"
+#endif
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    uint8 role;                 // USER_ROLE_NONE for a free entry
+    uint8 pin_length;           // USER_PIN_MIN .. USER_PIN_MAX
+    uint8 timeout;              // Session timeout in seconds, USER_TIMEOUT_MIN .. 255
+}user_entry_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Reads every user of the table, a user without a valid copy or with a bad
+ *        record is a free entry. A user whose PIN is still in clear is hashed and rewritten
+ *        to both copies, an older copy still holding a PIN in clear is overwritten.
+ *        Call it once after config_store_init().
+ * 
+ * @param seed A value that changes from boot to boot, the salts of the rewritten users are made from it.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_init(uint8 seed);
+
+/**
+ * @brief Reads a user from RAM.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param user A pointer to store the user, its role is USER_ROLE_NONE for a free entry.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_get(uint8 index, user_entry_t *user);
+
+/**
+ * @brief Adds a user or replaces it, the record is written in the background.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param user A pointer to the user.
+ * @param pin The key codes of the PIN (user->pin_length of them, 0 .. USER_PIN_CODES_NUM - 1).
+ * @param salt A value that should differ from the previous salts, a timer reading will do.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: Wrong index or user out of range, nothing is changed.
+ */
+Std_ReturnType user_table_set(uint8 index, const user_entry_t *user, const uint8 *pin, uint8 salt);
+
+/**
+ * @brief Removes a user, the record is written in the background.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_remove(uint8 index);
+
+/**
+ * @brief Counts the users of a role.
+ * 
+ * @param role The role (USER_ROLE_NONE counts the free entries).
+ * @param count A pointer to store the number of users.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType user_table_count(uint8 role, uint8 *count);
+
+/**
+ * @brief Checks a PIN against the digest of a user, in the time of one hash (USER_HASH_CYCLES
+ *        at most) whatever the PIN, the user or the position of the first wrong key.
+ * 
+ * @param index The user (0 .. USER_TABLE_USERS_NUM - 1).
+ * @param pin The key codes of the entered PIN.
+ * @param length The number of keys entered.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The PIN is the one of the user.
+ *         - E_NOT_OK: Wrong PIN, free entry or wrong parameters.
+ */
+Std_ReturnType user_table_check_pin(uint8 index, const uint8 *pin, uint8 length);
+
+#endif	/* USER_TABLE_H */
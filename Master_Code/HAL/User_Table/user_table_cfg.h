@@ -0,0 +1,25 @@
+/* 
+ * File:   user_table_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:05 PM
+ */
+
+#ifndef USER_TABLE_CFG_H
+#define	USER_TABLE_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define USER_TABLE_START_ADDRESS    0x60U   // First byte of the region reserved for the table
+#define USER_TABLE_USERS_NUM        6U      // Users 0 .. USER_TABLE_USERS_NUM - 1, one keypad digit selects a user
+#define USER_HASH_ROUNDS            40U     // Rounds of the PIN hash, more rounds make a PIN read from the EEPROM slower to find
+#define USER_HASH_BUDGET_MS         50U     // Longest time allowed for one hash, checked when compiling
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* USER_TABLE_CFG_H */
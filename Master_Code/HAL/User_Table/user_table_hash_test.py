@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+#
+# File:   user_table_hash_test.py
+# Author: Mohamed Sameh
+#
+# Host test and cost model of the PIN hash of user_table.c. It builds user_table.c with the host C
+# compiler and gcov (the configuration store and the EEPROM are replaced by stubs, the table starts
+# empty and every commit is accepted) and:
+#   - checks the 10000 4-digit PINs against one user, exactly one must be accepted,
+#   - counts the digest collisions of the 10000 PINs under one salt (about 3 expected for 24 bits),
+#   - counts with gcov the table lookups done by every line of user_table_hash(),
+#   - weights those counts with a PIC18 instruction model of the code XC8 makes of each line and
+#     prints the instruction cycles of one hash, the cycles per lookup and the time at _XTAL_FREQ.
+# The cycles are an estimate from the instruction model below, not a measurement on the target:
+# USER_HASH_LOOKUP_CYCLES in user_table.h must be at least the modelled value, the script fails if not.
+#     python3 user_table_hash_test.py
+#
+# Created on October 19, 2026, 11:50 PM
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+MCAL = os.path.join(HERE, "..", "..", "MCAL")
+
+# PIC18 instruction sequences, in instruction cycles (TBLRD* and a taken branch take 2)
+TABLE_READ = [("ADDLW low(table)", 1), ("MOVWF TBLPTRL", 1), ("MOVLW high(table)", 1),
+              ("MOVWF TBLPTRH", 1), ("MOVLW 0", 1), ("ADDWFC TBLPTRH,F", 1),
+              ("TBLRD*", 2), ("MOVF TABLAT,W", 1)]
+FSR_INDEX = [("MOVF index,W", 1), ("ADDWF ptr,W", 1), ("MOVWF FSR2L", 1), ("MOVLW 0", 1),
+             ("ADDWFC ptr+1,W", 1), ("MOVWF FSR2H", 1)]
+LOOP_STEP = [("INCF counter,F", 1), ("MOVF limit,W", 1), ("CPFSGT counter", 1), ("BRA loop", 2)]
+XOR_LOAD = [("MOVF operand,W", 1), ("XORWF l_hash,W", 1)]
+STORE = [("MOVWF l_hash", 1)]
+
+
+def cycles(*sequences):
+    return sum(c for sequence in sequences for _, c in sequence)
+
+
+# Cost of one execution of every line of user_table_hash() that does a lookup or moves the lanes
+LINE_MODEL = [
+    (r"digest\[l_lane\] \^ l_round", cycles(LOOP_STEP, FSR_INDEX, [("MOVF INDF2,W", 1), ("XORWF l_round,W", 1)],
+                                            TABLE_READ, STORE), True),
+    (r"l_hash \^ salt", cycles(XOR_LOAD, TABLE_READ, STORE), True),
+    (r"l_hash \^ length", cycles(XOR_LOAD, TABLE_READ, STORE, [("CLRF l_key", 1)]), True),
+    (r"l_hash \^ pin\[l_key\]", cycles(LOOP_STEP, FSR_INDEX, [("MOVF INDF2,W", 1), ("XORWF l_hash,W", 1)],
+                                       TABLE_READ, STORE), True),
+    (r"l_next = \(uint8\)", cycles([("INCF l_lane,W", 1), ("MOVWF l_next", 1)]), False),
+    (r"if\(l_next >= ", cycles([("MOVLW 3", 1), ("CPFSLT l_next", 1), ("BRA", 2)]), False),
+    (r"l_next = ZERO_INIT", cycles([("CLRF l_next", 1)]), False),
+    (r"\^ digest\[l_next\]", cycles(FSR_INDEX, [("MOVF INDF2,W", 1), ("XORWF l_hash,W", 1)], TABLE_READ, STORE), True),
+    (r"digest\[l_lane\] = l_hash", cycles(FSR_INDEX, [("MOVFF l_hash,INDF2", 2)]), False),
+]
+ROUND_STEP = cycles(LOOP_STEP, [("CLRF l_lane", 1)])
+CALL_COST = 40      # CALL, RETURN, the parameters and the 3 lane seeds
+
+
+def lwmod_cycles(divisor):
+    """XC8 __lwmod (16-bit unsigned remainder) as the previous (l_lane + 1U) % 3 called it"""
+    shifts = 0
+    while (divisor & 0x8000) == 0:
+        divisor <<= 1
+        shifts += 1
+    return 20 + shifts * 7 + (shifts + 1) * 12
+
+
+DRIVER = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "user_table.c"
+
+Std_ReturnType config_store_record_load(config_record_t *record, uint8 *data)
+{
+    (void)record; (void)data;
+    return E_NOT_OK;
+}
+
+Std_ReturnType config_store_record_commit(config_record_t *record, const uint8 *data)
+{
+    (void)record; (void)data;
+    return E_OK;
+}
+
+Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData)
+{
+    (void)bAdd;
+    *bData = 0xFF;
+    return E_OK;
+}
+
+static int compare(const void *a, const void *b)
+{
+    uint32 x = *(const uint32 *)a, y = *(const uint32 *)b;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[])
+{
+    static uint32 digests[10000];
+    static const uint8 stored[USER_PIN_MAX] = {1, 2, 3, 4, 5, 6, 7, 8};
+    user_entry_t user = {USER_ROLE_ADMIN, 4, 60};
+    uint8 pin[USER_PIN_MAX] = {0};
+    uint8 digest[USER_DIGEST_SIZE];
+    unsigned n, accepted = 0, collisions = 0, length;
+    clock_t start;
+
+    (void)argv;
+    if(argc > 1)
+    {
+        //One hash of the longest PIN, the run profiled for the cycle model
+        user_table_hash(stored, USER_PIN_MAX, 0x5A, digest);
+        return 0;
+    }
+    user_table_init(0);
+    user_table_set(0, &user, stored, 0x5A);
+    printf("hashes 4 1\n");
+    start = clock();
+    for(n = 0; n < 10000; n++)
+    {
+        pin[0] = n / 1000; pin[1] = (n / 100) % 10; pin[2] = (n / 10) % 10; pin[3] = n % 10;
+        accepted += (E_OK == user_table_check_pin(0, pin, 4));
+    }
+    printf("check_us %.3f\n", 1e6 * (double)(clock() - start) / CLOCKS_PER_SEC / 10000);
+    printf("hashes 4 10000\n");
+    printf("accepted %u\n", accepted);
+    for(n = 0; n < 10000; n++)
+    {
+        pin[0] = n / 1000; pin[1] = (n / 100) % 10; pin[2] = (n / 10) % 10; pin[3] = n % 10;
+        user_table_hash(pin, 4, 0x5A, digest);
+        digests[n] = ((uint32)digest[0] << 16) | ((uint32)digest[1] << 8) | digest[2];
+    }
+    printf("hashes 4 10000\n");
+    qsort(digests, 10000, sizeof(digests[0]), compare);
+    for(n = 1; n < 10000; n++)
+    {
+        collisions += (digests[n] == digests[n - 1]);
+    }
+    printf("collisions %u\n", collisions);
+    for(length = USER_PIN_MIN; length <= USER_PIN_MAX; length++)
+    {
+        user_table_hash(stored, length, 0x5A, digest);
+        printf("hashes %u 1\n", length);
+    }
+    return 0;
+}
+"""
+
+
+def header_values():
+    values = {}
+    for name in ("user_table_cfg.h", "user_table.h"):
+        with open(os.path.join(HERE, name)) as header:
+            for key, value in re.findall(r"#define\s+(USER_\w+)\s+(?:\(uint8\))?(\d+)U?L?\b", header.read()):
+                values[key] = int(value)
+    with open(os.path.join(MCAL, "device_config.h")) as header:
+        values["_XTAL_FREQ"] = int(re.search(r"_XTAL_FREQ\s+(\d+)", header.read()).group(1))
+    return values
+
+
+def hash_line_counts(work):
+    """Executions of the lines of user_table_hash(), from the gcov report of user_table.c"""
+    subprocess.run(["gcov", "-o", work, os.path.join(work, "driver.c")], cwd=work,
+                   capture_output=True, check=True)
+    with open(os.path.join(work, "user_table.c.gcov")) as report:
+        lines = report.read().splitlines()
+    counts = []
+    inside = False
+    for line in lines:
+        count, _, source = (part.strip() if i < 2 else part for i, part in enumerate(line.split(":", 2)))
+        if source.startswith("static void user_table_hash(") and not source.rstrip().endswith(";"):
+            inside = True
+        elif inside and source.startswith("}"):
+            break
+        if inside:
+            counts.append((int(count) if count.isdigit() else 0, source))
+    return counts
+
+
+def main():
+    values = header_values()
+    rounds = values["USER_HASH_ROUNDS"]
+    lanes = values["USER_DIGEST_SIZE"]
+    work = tempfile.mkdtemp()
+    try:
+        # The headers only need the types of <xc.h>, no register
+        open(os.path.join(work, "xc.h"), "w").close()
+        open(os.path.join(work, "pic18f4620.h"), "w").close()
+        with open(os.path.join(work, "driver.c"), "w") as source:
+            source.write(DRIVER)
+        binary = os.path.join(work, "driver")
+        compiler = os.environ.get("CC", "cc")
+        # Compiled then linked, so the gcov notes are named after driver.c
+        subprocess.run([compiler, "-std=c99", "-O0", "--coverage", "-I", work, "-I", HERE,
+                        "-c", "-o", os.path.join(work, "driver.o"), os.path.join(work, "driver.c")], cwd=work, check=True)
+        subprocess.run([compiler, "--coverage", "-o", binary, os.path.join(work, "driver.o")], cwd=work, check=True)
+        output = subprocess.run([binary], cwd=work, capture_output=True, text=True, check=True).stdout
+        total_counts = hash_line_counts(work)
+        os.remove(os.path.join(work, "driver.gcda"))
+        subprocess.run([binary, "model"], cwd=work, check=True)
+        counts = hash_line_counts(work)
+    finally:
+        shutil.rmtree(work)
+
+    results = {}
+    hashes = []
+    for line in output.splitlines():
+        key, *fields = line.split()
+        if key == "hashes":
+            hashes.append((int(fields[0]), int(fields[1])))
+        else:
+            results[key] = fields[0]
+
+    print("10000 4-digit PINs against one user: %s accepted, %s digest collisions under one salt"
+          % (results["accepted"], results["collisions"]))
+    print("host: %s us per check" % results["check_us"])
+
+    # Lookups of every hash of the checks, they depend on the length only
+    lookups = sum(count for count, source in total_counts
+                  for pattern, _, is_lookup in LINE_MODEL if is_lookup and re.search(pattern, source))
+    expected = sum(n * rounds * lanes * (length + 4) for length, n in hashes)
+    print("lookups counted by gcov %d, by the formula %d" % (lookups, expected))
+
+    # One hash of the longest PIN, the case USER_HASH_CYCLES is checked against
+    longest = values["USER_PIN_MAX"]
+    per_hash_lookups = 0
+    per_hash = CALL_COST + rounds * ROUND_STEP
+    for count, source in counts:
+        for pattern, cost, is_lookup in LINE_MODEL:
+            if re.search(pattern, source):
+                per_hash += count * cost
+                per_hash_lookups += count if is_lookup else 0
+    per_lookup = per_hash / per_hash_lookups
+    mhz = values["_XTAL_FREQ"] / 4e6
+    lwmod = lwmod_cycles(lanes)
+    print("model: %d lookups and %d cycles per hash of %d keys, %.1f cycles per lookup, %.1f ms at %.0f MHz"
+          % (per_hash_lookups, per_hash, longest, per_lookup, per_hash / mhz / 1000, mhz * 4))
+    print("       the (l_lane + 1U) %% %d of the previous code called __lwmod, about %d cycles, %d per hash (+%.0f %%)"
+          % (lanes, lwmod, lwmod * rounds * lanes, 100.0 * lwmod * rounds * lanes / per_hash))
+    header = values["USER_HASH_LOOKUP_CYCLES"]
+    print("USER_HASH_LOOKUP_CYCLES %d: %s" % (header, "covers the model" if header >= per_lookup else "BELOW THE MODEL"))
+    ok = (results["accepted"] == "1") and (lookups == expected) and (header >= per_lookup)
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
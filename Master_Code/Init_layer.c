@@ -131,4 +131,8 @@ void application_init()
    ret = led_init(&Guest_led);
    ret = led_init(&Block_led);
    ret = SPI_Master_Init(&spi);
+   ret = EEPROM_Init();//the queued writes run in the background from now on
+   ret = EUSART_Init();//diagnostics on RC6/RC7, the writes never wait
+   ret = event_log_init();
+   ret = Timer0_Init(&timer);//runs from the boot, it keeps the time of the event log
 }
\ No newline at end of file
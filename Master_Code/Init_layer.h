@@ -12,10 +12,14 @@
 #include "HAL/LED/led.h"
 #include "HAL/Keypad/keypad.h"
 #include "HAL/Chr_LCD/chr_lcd.h"
+#include "HAL/Config_Store/config_store.h"
+#include "HAL/Event_Log/event_log.h"
+#include "HAL/User_Table/user_table.h"
 #include "MCAL/interrupt/internal_interrupt.h"
 #include "MCAL/EEPROM/eeprom.h"
 #include "MCAL/TIMER0/timer0.h"
 #include "MCAL/SPI/spi.h"
+#include "MCAL/EUSART/eusart.h"
 
 /* Section : Macro Declarations */
 
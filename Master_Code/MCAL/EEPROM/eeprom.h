@@ -1,6 +1,15 @@
 /* 
  * File:   eeprom.h
  * Author: Mohamed Sameh
+ * Description:
+ * Data EEPROM driver. Writes go through a queue served by the EEPROM write complete interrupt
+ * (EEIF): EEPROM_WriteBlock_Async() copies the bytes and returns at once, every interrupt starts
+ * the next queued byte and the callback of a request runs (in interrupt context) once its last byte
+ * is committed. The interrupts are disabled only for the 0x55/0xAA unlock sequence of every byte.
+ * Reads return the newest queued value of an address that isn't committed yet.
+ * A queued byte equal to the one in the memory is dropped when its turn comes, without a write cycle
+ * (about 4 ms and one erase/write of endurance saved), unless it carries the callback of its request.
+ * EEPROM_WriteByte() and EEPROM_WriteBlock() queue the same way and wait for the queue to empty.
  *
  * Created on September 21, 2023, 5:46 PM
  */
@@ -27,14 +36,65 @@
 
 #define INITIATE_EEPROM_DATA_READ          1
 
+//Bytes waiting to be written, a request larger than the free space is refused
+#define EEPROM_QUEUE_SIZE      32U
+//Size of the data EEPROM of the PIC18F4620
+#define EEPROM_SIZE            1024U
+
+//Write engine status.
+#define EEPROM_IDLE            0x00
+#define EEPROM_BUSY            0x01
+
 /* -------------- Macro Functions Declarations --------------*/
 
 /* -------------- Data Types Declarations --------------  */
 
 /* -------------- Functions Declarations --------------*/
 /**
- * @brief Writes one byte of data to a specific EEPROM Address.
- * 
+ * @brief Initializes the write engine and enables the EEPROM write complete interrupt.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Init(void);
+
+/**
+ * @brief Queues a block of data to be written in the background.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData The data to be written, it's copied so it may change after the call.
+ * @param size The number of bytes (1 .. EEPROM_QUEUE_SIZE).
+ * @param callback Called from the EEPROM interrupt once the last byte is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The block is queued.
+ *         - E_NOT_OK: Wrong parameters or not enough free space in the queue, nothing is queued.
+ */
+Std_ReturnType EEPROM_WriteBlock_Async(uint16 bAdd, const uint8 *bData, const uint8 size, void (*callback)(void));
+
+/**
+ * @brief Reads whether queued bytes are still being written.
+ *
+ * @param status A pointer to store the status (@ref EEPROM_IDLE, @ref EEPROM_BUSY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Get_Status(uint8 *status);
+
+/**
+ * @brief Waits until all the queued bytes are written.
+ *        It serves the engine itself when the interrupts are disabled.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Flush(void);
+
+/**
+ * @brief Writes one byte of data to a specific EEPROM Address and waits until it's written.
+ *
  * @param bAdd The EEPROM address to write at.
  * @param bData Data to be written.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
@@ -43,10 +103,21 @@
  */
 Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData);
 
+/**
+ * @brief Writes a block of data and waits until it's written.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData The data to be written.
+ * @param size The number of bytes (1 .. EEPROM_QUEUE_SIZE).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
 Std_ReturnType EEPROM_WriteBlock(uint16 bAdd, const uint8 *bData, const uint8 size);
+
 /**
  * @brief Reads one byte of data from a specific EEPROM Address.
- * 
+ *
  * @param bAdd The EEPROM address to read from..
  * @param bData A pointer to store the read data.
  * @return Std_ReturnType A status indicating the success or failure of the operation.
@@ -55,6 +126,16 @@ Std_ReturnType EEPROM_WriteBlock(uint16 bAdd, const uint8 *bData, const uint8 si
  */
 Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData);
 
+/**
+ * @brief Reads a block of data.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData A pointer to store the read data.
+ * @param size The number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
 Std_ReturnType EEPROM_ReadBlock(uint16 bAdd, uint8 *bData, const uint8 size);
 #endif	/* EEPROM_H */
 
@@ -23,6 +23,9 @@
 #define TIMER2_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
 #define TIMER3_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
 
+//EEIF drives the queued EEPROM writes
+#define EEPROM_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
+
 #define CCP1_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
 #define CCP2_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
 
@@ -117,6 +117,13 @@ void __interrupt() InterruptManager(void)
     }
     /*_________________________ TIMER END _________________________________*/
 
+    /*_________________________ EEPROM START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE2bits.EEIE && INTERRUPT_OCCURRED == PIR2bits.EEIF)
+    {
+        EEPROM_ISR(); /* EEPROM WRITE INTERRUPT */
+    }
+    /*_________________________ EEPROM END _________________________________*/
+
     /*_________________________ SPI START _________________________________*/
     if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF && SSPCON1bits.SSPM <= 5)
     {
@@ -124,6 +131,17 @@ void __interrupt() InterruptManager(void)
     }
     /*_________________________ SPI END _________________________________*/
 
+    /*_________________________ EUSART START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.RCIE && INTERRUPT_OCCURRED == PIR1bits.RCIF)
+    {
+        EUSART_RX_ISR(); /* EUSART RECEIVE INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.TXIE && INTERRUPT_OCCURRED == PIR1bits.TXIF)
+    {
+        EUSART_TX_ISR(); /* EUSART TRANSMIT INTERRUPT */
+    }
+    /*_________________________ EUSART END _________________________________*/
+
 
 }
 
@@ -8,19 +8,49 @@
 
 uint8 keypad_value = NO_KEY_PRESSED;
 uint8 login_mode = NO_MODE;
-uint8 Admin_Pass_Status = PASS_NOT_SET;
-uint8 Guest_Pass_Status = PASS_NOT_SET;
+uint8 login_user = NOT_SELECTED;//index of the logged in user in the user table
+config_record_t Credentials_record = {.slot_address = {CREDENTIALS_SLOT_A_ADDRESS, CREDENTIALS_SLOT_B_ADDRESS}, .size = CREDENTIALS_SIZE};
+//default value and range of every key of the configuration store, unused keys hold 0
+const config_store_field_t Config_fields[CONFIG_STORE_KEYS_NUM] =
+{
+    [CONFIG_KEY_ADMIN_PASS_STATUS] = {.default_value = PASS_NOT_SET, .min = 0x00, .max = 0xFF},
+    [CONFIG_KEY_GUEST_PASS_STATUS] = {.default_value = PASS_NOT_SET, .min = 0x00, .max = 0xFF},
+    [CONFIG_KEY_LOGIN_BLOCKED]     = {.default_value = FALSE, .min = FALSE, .max = TRUE},
+    [CONFIG_KEY_BOOT_COUNT]        = {.default_value = 0, .min = 0, .max = 0xFFFF},
+    [CONFIG_KEY_LOCKOUT_LEVEL]     = {.default_value = 0, .min = 0, .max = LOCKOUT_LEVEL_MAX},
+    [CONFIG_KEY_LOCKOUT_REMAINING] = {.default_value = 0, .min = 0, .max = LOCKOUT_MAX_TIME},
+    [CONFIG_KEY_FAILED_TRIES]      = {.default_value = 0, .min = 0, .max = TRIES_ALLOWED},
+};
 
-volatile uint16 session_counter = 0;//indicate session time
-uint8 block_mode_flag = FALSE;//is true if the login is blocked or false if is not blocked
+volatile uint8 session_state = SESSION_CLOSED;//set by the timer interrupt, a single byte is read atomically
+volatile uint16 session_idle_ticks = 0;//ticks left before the idle timeout, counted down by the timer interrupt
+volatile uint16 session_seconds_left = 0;//seconds left before the end of the longest session
+uint16 session_idle_limit = 0;//idle timeout of the logged in user in ticks
+uint8 session_warning_shown = FALSE;//the warning of the coming end was shown
+volatile uint8 uptime_ticks = 0;//ticks of the current second
+volatile uint32 uptime_seconds = 0;//seconds since the boot
+uint8 pass_tries_count = 0;//wrong passwords since the last login or lockout, kept in the configuration store
+uint8 lockout_level = 0;//lockouts in a row, the next one lasts LOCKOUT_BASE_TIME << lockout_level
+uint16 lockout_remaining = 0;//seconds left of the lockout, 0 if the login isn't blocked
+uint32 lockout_second = 0;//second of the uptime the countdown was last updated at
 uint8 timeout_flag = FALSE;//stores if the session is still valid or outdated
 
-uint8 temperature = 0;//The average temperature of the room
+uint16 temperature = 0;//The required temperature of the room in tenths of a degree
 uint8 temp_ones = NOT_SELECTED;//The entered right number of the temperature
 uint8 temp_tens = NOT_SELECTED;//The entered left number of the temperature
+uint8 temp_tenths = NOT_SELECTED;//The entered fraction of the temperature, 0 or 5
+
+volatile uint8 refresh_ticks = 0;//ticks since the last step of the live temperature refresh
+uint8 refresh_state = REFRESH_IDLE;//a refresh request is waiting for its response or not
+uint8 refresh_index = 0;//response bytes received
+uint8 refresh_response[REFRESH_RESPONSE_BYTES] = {0};//current and target temperatures, high byte first
+uint8 refresh_row = REFRESH_NO_FIELD;//position of the live temperature on the shown screen
+uint8 refresh_column = 0;
 
 int main() 
 {
+    uint8 admins_count = 0;//admins in the user table
+    user_entry_t user;//the user that logs in
     /*****************  INITIALIZE  ***********************/
     application_init();
     /******************************************************/
@@ -32,89 +62,40 @@ int main()
     lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
     /***************************/
 	/* Setting Admin and Guest passwords if not set */
-	//read the state of the the passwords of the admin and guest if both are set or not set
-    EEPROM_ReadByte(ADMIN_PASS_STATUS_ADDRESS, &Admin_Pass_Status);
-    EEPROM_ReadByte(GUEST_PASS_STATUS_ADDRESS, &Guest_Pass_Status);
-    if((PASS_SET != Admin_Pass_Status) || (PASS_SET != Guest_Pass_Status))
+	//all the settings are read once, the rest of the code uses their RAM copy
+    Config_Load();
+    user_table_count(USER_ROLE_ADMIN, &admins_count);
+    if(admins_count == 0)//nobody could manage the users
     {
         lcd_8bit_send_string(&LCD,"Login for");
         lcd_8bit_send_string_pos(&LCD, "first time", 2,1);
         __delay_ms(1000);//Halt the system for the given time in (ms)
         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
         
-        lcd_8bit_send_string(&LCD," Set Admin Pass");
-        lcd_8bit_send_string_pos(&LCD, "Admin pass:", 2,1);
-        
         /********************************* setting Admin password **********************************************/
-        /* the counter of the characters of the password */
-        uint8 password_counter = 0;
-        uint8 password[PASS_SIZE] = {NOT_STORED,NOT_STORED,NOT_STORED,NOT_STORED};
-        /* loop until the user finishes inserting the password */
-        while (password_counter < PASS_SIZE)
-		{
-            keypad_value = NO_KEY_PRESSED;
-            while(keypad_value == NO_KEY_PRESSED)
-            {
-                keypad_value = keypad_get_value(&keypad);
-            }
-            password[password_counter] = keypad_value; //add the pressed character to the pass array
-            lcd_8bit_send_char(&LCD, keypad_value);
-            __delay_ms(CHARACTER_PREVIEW_TIME);//Halt the system for the given time in (ms)
-            lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 12+password_counter);
-            __delay_ms(100);//Halt the system for the given time in (ms)
-            password_counter++;//increase the characters count
-        }
-        EEPROM_WriteBlock(EEPROM_ADMIN_ADDRESS, password, PASS_SIZE);//save the entire password as a block to the EEPROM
-        EEPROM_WriteByte(ADMIN_PASS_STATUS_ADDRESS, PASS_SET);       //write the status of pass as it is set
-        
-        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-        lcd_8bit_send_string(&LCD,"Pass Saved");
-        __delay_ms(500);
-        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD," Set Admin Pass");
+        __delay_ms(1000);//Halt the system for the given time in (ms)
+        //asked again till a valid user is saved, every user is committed on its own
+        while(EditUser(FIRST_ADMIN_USER, ADMIN, NO_MODE) == FALSE);
         
         /********************************* setting guest password **********************************************/
-        password_counter = 0;
-        lcd_8bit_send_string(&LCD,"Set Guest Pass");
-        lcd_8bit_send_string_pos(&LCD, "Guest pass:", 2,1);
-        /* loop until the user finishes inserting the password */
-        while (password_counter < PASS_SIZE)
-		{
-            keypad_value = NO_KEY_PRESSED;
-            while(keypad_value == NO_KEY_PRESSED)
-            {
-                keypad_value = keypad_get_value(&keypad);
-            }
-            password[password_counter] = keypad_value;//add the pressed character to the pass array
-            lcd_8bit_send_char(&LCD, keypad_value);
-            __delay_ms(CHARACTER_PREVIEW_TIME);//Halt the system for the given time in (ms)
-            lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 12+password_counter);
-            __delay_ms(100);//Halt the system for the given time in (ms)
-            password_counter++;//increase the characters count
-        }
-        EEPROM_WriteBlock(EEPROM_GUEST_ADDRESS, password, PASS_SIZE);//save the entire password as a block to the EEPROM
-        EEPROM_WriteByte(GUEST_PASS_STATUS_ADDRESS, PASS_SET);//write the status of pass as it is set
-        
         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-        lcd_8bit_send_string(&LCD,"Pass Saved");
-        __delay_ms(500);
+        lcd_8bit_send_string(&LCD,"Set Guest Pass");
+        __delay_ms(1000);//Halt the system for the given time in (ms)
+        while(EditUser(FIRST_GUEST_USER, GUEST, NO_MODE) == FALSE);
         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-    }//The end of whether admin and guest passwords are set or not
-    /* this code runs only if the system is not running for the first time (ADMIN and GUEST passwords are set)*/
-    else
-    {
-        EEPROM_ReadByte(LOGIN_BLOCKED_ADDRESS, &block_mode_flag);
-    }
+    }//The end of whether an admin is set or not
     while(1)
     {
         keypad_value = NO_KEY_PRESSED;
-        uint8 pass_tries_count = 0; //stores how many times the user tried to log in and failed
         
         if(timeout_flag == TRUE)
         {
-            Timer0_DeInit(&timer);
-            session_counter = 0;//clear session counter
+            Log_Event(LOG_EVENT_TIMEOUT, login_mode, LOG_DEVICE_NONE);
+            Session_Close();
             timeout_flag=FALSE;//clear time out flag
 			login_mode=NO_MODE;//log the user out
+            login_user = NOT_SELECTED;
             keypad_value = NO_KEY_PRESSED;
             led_turn_off(&Admin_led);
             led_turn_off(&Guest_led);
@@ -124,153 +105,90 @@ int main()
         }
         while (login_mode == NO_MODE)
         {
-            if(block_mode_flag==TRUE)
+            if(Lockout_Task() != 0)//the lockout goes on after a reset
             {
-                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                lcd_8bit_send_string(&LCD, "Login blocked");
-                lcd_8bit_send_string_pos(&LCD, "wait 20 seconds", 2,1);
-                led_turn_on(&Block_led);
-                __delay_ms(BLOCK_MODE_TIME);
-                led_turn_off(&Block_led);
-                pass_tries_count = 0;
-                block_mode_flag = FALSE;
-                EEPROM_WriteByte(LOGIN_BLOCKED_ADDRESS, FALSE); //Write false at blocked location in EEPROM
+                ShowLockout();//counts down till the end of the lockout
             }
             lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-            lcd_8bit_send_string(&LCD, "Select mode:");
-            lcd_8bit_send_string_pos(&LCD, "0:Admin 1:Guest", 2,1);
+            lcd_8bit_send_string(&LCD, "Select user:");
+            lcd_8bit_send_string_pos(&LCD, "0-", 2,1);
+            lcd_8bit_send_char(&LCD, ASCII_ZERO + USER_TABLE_USERS_NUM - 1);
+            lcd_8bit_send_string(&LCD, " then PIN");
             keypad_value = NO_KEY_PRESSED;
             while(keypad_value == NO_KEY_PRESSED)
             {
                 keypad_value = keypad_get_value(&keypad);
+                config_store_task();//writes a changed setting when the EEPROM is idle
             }
-            if((keypad_value != ADMIN_MODE) && (keypad_value != GUEST_MODE))
+            //the key is the index of the user, the login doesn't search the table
+            if((keypad_value < '0') || (keypad_value >= (ASCII_ZERO + USER_TABLE_USERS_NUM)) ||
+               (E_OK != user_table_get(keypad_value - ASCII_ZERO, &user)) || (user.role == NO_MODE))
 			{
 				lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//remove all previously printed characters on the LCD and move the cursor to the first column of the first row
 				lcd_8bit_send_string(&LCD, "Wrong input.");//Prints error message on the LCD
 				keypad_value = NO_KEY_PRESSED;//return the variable that holds the pressed key from keypad to its initial value
 				__delay_ms(1000);//Halt the system for the given time in (ms)
-				continue;//return to the loop of login #while (login_mode==NO_MODE)# line 121
+				continue;//return to the loop of login #while (login_mode==NO_MODE)#
 			}
-            uint8 password_counter = 0;//counts the entered key of the password from the keypad
-			uint8 password[PASS_SIZE] = {NOT_STORED,NOT_STORED,NOT_STORED,NOT_STORED};//temporarily hold the entire password that will be entered by the user to be checked
-			uint8 stored_password[PASS_SIZE] = {NOT_STORED,NOT_STORED,NOT_STORED,NOT_STORED};//temporarily hold the entire stored password that is written by the user for the first time
+            uint8 user_index = keypad_value - ASCII_ZERO;//the user that logs in
+			uint8 password[USER_PIN_MAX];//temporarily hold the entire password that will be entered by the user to be checked
+            Std_ReturnType pin_check = E_NOT_OK;//the result of the check of the password
             
-            switch(keypad_value)
-			{
-                case ADMIN_MODE:
-                    while(login_mode != ADMIN)
+            while(login_mode == NO_MODE)
+            {
+                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                lcd_8bit_send_string(&LCD, "User ");
+                lcd_8bit_send_char(&LCD, keypad_value);
+                lcd_8bit_send_string(&LCD, (user.role == ADMIN) ? " Admin" : " Guest");
+                __delay_ms(200);
+                GetPin(NO_MODE, user.pin_length, password);
+                /*compare the digest of the password, it takes the same time for any password*/
+                pin_check = user_table_check_pin(user_index, password, user.pin_length);
+                memset(password, 0, sizeof(password));//the password isn't kept in RAM
+                if(pin_check == E_OK)//in case of right password
+                {
+                    login_mode = user.role;
+                    login_user = user_index;
+                    pass_tries_count = 0;//clear the counter of wrong tries
+                    lockout_level = 0;//the next lockout is a short one again
+                    config_store_write(CONFIG_KEY_FAILED_TRIES, pass_tries_count);//written by the background writer
+                    config_store_write(CONFIG_KEY_LOCKOUT_LEVEL, lockout_level);
+                    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                    lcd_8bit_send_string(&LCD, "Right password");
+                    if(login_mode == ADMIN)
                     {
-                        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        lcd_8bit_send_string(&LCD, "Admin mode");
-                        lcd_8bit_send_string_pos(&LCD, "Enter Pass:", 2,1);
-                        __delay_ms(200);
-                        password_counter = 0;
-                        while(password_counter < PASS_SIZE)
-                        {
-                            keypad_value = NO_KEY_PRESSED;
-                            while(keypad_value == NO_KEY_PRESSED)
-                            {
-                                keypad_value = keypad_get_value(&keypad);
-                            }
-                            password[password_counter] = keypad_value;//add the pressed character to the pass array
-                            lcd_8bit_send_char(&LCD, keypad_value);
-                            __delay_ms(CHARACTER_PREVIEW_TIME);//Halt the system for the given time in (ms)
-                            lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 12+password_counter);
-                            __delay_ms(50);//Halt the system for the given time in (ms)
-                            password_counter++;//increase the characters count
-                        }
-                        EEPROM_ReadBlock(EEPROM_ADMIN_ADDRESS, stored_password, PASS_SIZE);
-                        /*compare passwords*/
-                        if((ComparePass(password, stored_password, PASS_SIZE)) == TRUE)//in case of right password
-                        {
-                            login_mode = ADMIN;
-                            pass_tries_count = 0;//clear the counter of wrong tries
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            lcd_8bit_send_string(&LCD, "Right password");
-                            lcd_8bit_send_string_pos(&LCD, "Admin mode", 2,1);
-                            __delay_ms(500);
-                            led_turn_on(&Admin_led);
-                            Timer0_Init(&timer);
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        }
-                        else
-                        {
-                            pass_tries_count++;//increase the number of wrong tries to block login if it exceeds the allowed tries
-                            login_mode = NO_MODE;//set the mode as not logged in
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            lcd_8bit_send_string(&LCD, "Wrong password");
-                            lcd_8bit_send_string_pos(&LCD, "Tries left:", 2,1);
-                            lcd_8bit_send_char(&LCD, TRIES_ALLOWED-pass_tries_count+48);
-                            __delay_ms(1000);
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            if (pass_tries_count>=TRIES_ALLOWED)//if the condition of the block mode is true
-                            {
-                                block_mode_flag = TRUE;//turn on block mode
-                                EEPROM_WriteByte(LOGIN_BLOCKED_ADDRESS,block_mode_flag);//write to the EEPROM TRUE to the the block mode address
-                                break;//break the loop of admin login #while(login_mode!=GUEST)# at line 158
-                            }
-                        } 
+                        lcd_8bit_send_string_pos(&LCD, "Admin mode", 2,1);
+                        led_turn_on(&Admin_led);
                     }
-                    break;
-                /********************************* Guest login **********************************************/
-                case GUEST_MODE:
-                   while(login_mode != GUEST)
+                    else
                     {
-                        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        lcd_8bit_send_string(&LCD, "Guest mode");
-                        lcd_8bit_send_string_pos(&LCD, "Enter Pass:", 2,1);
-                        __delay_ms(200);
-                        password_counter = 0;
-                        while(password_counter < PASS_SIZE)
-                        {
-                            keypad_value = NO_KEY_PRESSED;
-                            while(keypad_value == NO_KEY_PRESSED)
-                            {
-                                keypad_value = keypad_get_value(&keypad);
-                            }
-                            password[password_counter] = keypad_value;//add the pressed character to the pass array
-                            lcd_8bit_send_char(&LCD, keypad_value);
-                            __delay_ms(CHARACTER_PREVIEW_TIME);//Halt the system for the given time in (ms)
-                            lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 12+password_counter);
-                            __delay_ms(50);//Halt the system for the given time in (ms)
-                            password_counter++;//increase the characters count
-                        }
-                        EEPROM_ReadBlock(EEPROM_GUEST_ADDRESS, stored_password, PASS_SIZE);
-                        /*compare passwords*/
-                        if((ComparePass(password, stored_password, PASS_SIZE)) == TRUE)//in case of right password
-                        {
-                            login_mode = GUEST;
-                            pass_tries_count = 0;//clear the counter of wrong tries
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            lcd_8bit_send_string(&LCD, "Right password");
-                            lcd_8bit_send_string_pos(&LCD, "Guest mode", 2,1);
-                            __delay_ms(500);
-                            led_turn_on(&Guest_led);
-                            Timer0_Init(&timer);
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        }
-                        else
-                        {
-                            pass_tries_count++;//increase the number of wrong tries to block login if it exceeds the allowed tries
-                            login_mode = NO_MODE;//set the mode as not logged in
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            lcd_8bit_send_string(&LCD, "Wrong password");
-                            lcd_8bit_send_string_pos(&LCD, "Tries left:", 2,1);
-                            lcd_8bit_send_char(&LCD, TRIES_ALLOWED-pass_tries_count+48);
-                            __delay_ms(1000);
-                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                            if (pass_tries_count>=TRIES_ALLOWED)//if the condition of the block mode is true
-                            {
-                                block_mode_flag = TRUE;//turn on block mode
-                                EEPROM_WriteByte(LOGIN_BLOCKED_ADDRESS,block_mode_flag);//write to the EEPROM TRUE to the the block mode address
-                                break;//break the loop of admin login #while(login_mode!=ADMIN)# at line 214
-                            }
-                        } 
-                    } 
-                    break;
-                defualt:
-                    break;
+                        lcd_8bit_send_string_pos(&LCD, "Guest mode", 2,1);
+                        led_turn_on(&Guest_led);
+                    }
+                    __delay_ms(500);
+                    Session_Start(user.timeout);//the session starts now
+                    Log_Event(LOG_EVENT_LOGIN, login_mode, LOG_DEVICE_NONE);
+                    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                }
+                else
+                {
+                    pass_tries_count++;//increase the number of wrong tries to block login if it exceeds the allowed tries
+                    config_store_write(CONFIG_KEY_FAILED_TRIES, pass_tries_count);
+                    config_store_flush();//queued now so a reset doesn't give new tries
+                    login_mode = NO_MODE;//set the mode as not logged in
+                    Log_Event(LOG_EVENT_LOGIN_FAIL, user.role, LOG_DEVICE_NONE);
+                    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                    lcd_8bit_send_string(&LCD, "Wrong password");
+                    lcd_8bit_send_string_pos(&LCD, "Tries left:", 2,1);
+                    lcd_8bit_send_char(&LCD, TRIES_ALLOWED-pass_tries_count+48);
+                    __delay_ms(1000);
+                    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                    if (pass_tries_count>=TRIES_ALLOWED)//if the condition of the block mode is true
+                    {
+                        Lockout_Start();//turn on block mode
+                        break;//break the loop of the user login #while(login_mode == NO_MODE)#
+                    }
+                }
             }
         }
         /*************************************************************************************************/
@@ -329,8 +247,8 @@ int main()
                     do
                     {
                         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        lcd_8bit_send_string(&LCD, "1:Room4 2:TV");
-                        lcd_8bit_send_string_pos(&LCD, "3:Air Cond.4:RET", 2,1);
+                        lcd_8bit_send_string(&LCD, "1:Room4 2:TV 5Lg");
+                        lcd_8bit_send_string_pos(&LCD, "3:AirC 6Usr 4RET", 2,1);
                         
                         keypad_value = GetKeyPressed(login_mode);
                         __delay_ms(50);//to avoid the duplication of the pressed key
@@ -351,21 +269,29 @@ int main()
                         {
                             show_menu = MAIN_MENU;
                         }
+                        else if(keypad_value == SELECT_EVENT_LOG)
+                        {
+                            show_menu = EVENT_LOG_MENU;
+                        }
+                        else if(keypad_value == SELECT_USERS)
+                        {
+                            show_menu = USERS_MENU;
+                        }
                         else if(keypad_value != NO_KEY_PRESSED)//show wrong input message if the user pressed wrong key
                         {
                             lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
                             lcd_8bit_send_string(&LCD, "Wrong input");
                             __delay_ms(500);//Halt the system for the given time in (ms)
                         }
-                    }while(((keypad_value < '1') || (keypad_value > '4') ) && (timeout_flag == FALSE));
+                    }while(((keypad_value < '1') || (keypad_value > '6') ) && (timeout_flag == FALSE));
                     break;//End of more menu case
                     
                 case AIRCONDITIONING_MENU:
                     do
                     {
                         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        lcd_8bit_send_string(&LCD, "1:Set temperature");
-                        lcd_8bit_send_string_pos(&LCD, "2:Control  0:RET", 2,1);
+                        lcd_8bit_send_string(&LCD, "1Set 3Spd 5PI");
+                        lcd_8bit_send_string_pos(&LCD, "2Ctl 4Tmp 6Tr 0R", 2,1);
 
                         keypad_value = GetKeyPressed(login_mode);
                         __delay_ms(50);//to avoid the duplication of the pressed key
@@ -378,6 +304,22 @@ int main()
                         {
                             show_menu = AIRCOND_CTRL_MENU;
                         }
+                        else if(keypad_value == SELECT_AIR_COND_SPEED)
+                        {
+                            show_menu = AIRCOND_SPEED_MENU;
+                        }
+                        else if(keypad_value == SELECT_ROOMS_TEMP)
+                        {
+                            show_menu = ROOMS_TEMP_MENU;
+                        }
+                        else if(keypad_value == SELECT_THERMOSTAT)
+                        {
+                            show_menu = THERMOSTAT_MENU;
+                        }
+                        else if(keypad_value == SELECT_TREND)
+                        {
+                            show_menu = TREND_MENU;
+                        }
                         else if(keypad_value == SELECT_AIR_COND_RET)
                         {
                             show_menu = MORE_MENU;
@@ -388,7 +330,7 @@ int main()
                             lcd_8bit_send_string(&LCD, "Wrong input");
                             __delay_ms(500);//Halt the system for the given time in (ms)
                         }
-                    }while(((keypad_value < '0') || (keypad_value > '2') ) && (timeout_flag == FALSE));
+                    }while(((keypad_value < '0') || (keypad_value > '6') ) && (timeout_flag == FALSE));
                     break;//End of air conditioning menu case
                     
                 case ROOM1_MENU:
@@ -423,6 +365,30 @@ int main()
                     MenuOption(AIRCOND_CTRL_MENU,login_mode);//call the function that show the menu of Air conditioning control
                     show_menu = AIRCONDITIONING_MENU;//Set the next menu to be shown to air conditioning menu
                     break;    
+                case AIRCOND_SPEED_MENU:
+                    SetAirCondSpeed(login_mode);//call the function that asks for the fan speed of the air conditioning
+                    show_menu = AIRCONDITIONING_MENU;//Set the next menu to be shown to air conditioning menu
+                    break;
+                case ROOMS_TEMP_MENU:
+                    ShowRoomsTemperature(login_mode);//call the function that shows the temperature of all rooms
+                    show_menu = AIRCONDITIONING_MENU;//Set the next menu to be shown to air conditioning menu
+                    break;
+                case THERMOSTAT_MENU:
+                    SetThermostatControl(login_mode);//call the function that sets the control mode and the PI gains
+                    show_menu = AIRCONDITIONING_MENU;//Set the next menu to be shown to air conditioning menu
+                    break;
+                case TREND_MENU:
+                    ShowTemperatureTrend(login_mode);//call the function that draws the temperature history
+                    show_menu = AIRCONDITIONING_MENU;//Set the next menu to be shown to air conditioning menu
+                    break;
+                case EVENT_LOG_MENU:
+                    ShowEventLog(login_mode);//call the function that pages through the event log
+                    show_menu = MORE_MENU;//Set the next menu to be shown to more menu
+                    break;
+                case USERS_MENU:
+                    ManageUsers(login_mode);//call the function that adds, changes and removes users
+                    show_menu = MORE_MENU;//Set the next menu to be shown to more menu
+                    break;
     
                 case TEMPERATURE_MENU:
                     temperature = 0;//clear the value of temperature
@@ -430,17 +396,23 @@ int main()
                     {
                         keypad_value = NO_KEY_PRESSED;
                         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
-                        lcd_8bit_send_string(&LCD, "Set temp.:__");
+                        lcd_8bit_send_string(&LCD, "Set temp.:__._");
                         lcd_8bit_send_char(&LCD, DEGREES_SYMBOL);
                         lcd_8bit_send_char(&LCD, 'C');
                         //lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 12+password_counter);
+                        lcd_8bit_send_string_pos(&LCD, "Now:", 2,1);
                         
+                        Refresh_Show(2, 5);//"Now:24.3/24.5"
                         keypad_value = GetKeyPressed(login_mode);//wait for the user till key is pressed or the time is out
                         __delay_ms(200);//to avoid the duplication of the pressed key
                         if(timeout_flag == TRUE) //in case of the time is out before the user press a key
                         {
                             break;//break the loop that ask for temperature
                         }
+                        if(keypad_value == NO_KEY_PRESSED)//the key answered the session warning, draw the prompt again
+                        {
+                            continue;
+                        }
                         if(keypad_value <'0' || keypad_value >'9')//show wrong input message if the user entered non numeric value
                         {
                             lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//remove all previously printed characters on the LCD and move the cursor to the first column of the first row
@@ -455,6 +427,7 @@ int main()
                             keypad_value = NO_KEY_PRESSED;//set the key pressed to the default value
                         }
                         /*******************************************************************************/   
+                        Refresh_Show(2, 5);
                         keypad_value = GetKeyPressed(login_mode);
                         __delay_ms(200);//to avoid the duplication of the pressed key
                         
@@ -462,6 +435,10 @@ int main()
                         {
                             break;//break the loop that ask for temperature
                         }
+                        if(keypad_value == NO_KEY_PRESSED)//the key answered the session warning, draw the prompt again
+                        {
+                            continue;
+                        }
                         if(keypad_value <'0' || keypad_value >'9')//show wrong input message if the user entered non numeric value
                         {
                             lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//remove all previously printed characters on the LCD and move the cursor to the first column of the first row
@@ -471,14 +448,50 @@ int main()
                         }
                         else//if the value is valid
                         {
-                            lcd_8bit_send_char(&LCD, keypad_value);
+                            lcd_8bit_send_char_pos(&LCD, keypad_value, 1, 12);//the refresh may have moved the cursor
                             temp_ones = keypad_value-ASCII_ZERO;//save the entered value
                             keypad_value = NO_KEY_PRESSED;//set the key pressed to the default value
                         }
-                        temperature = temp_tens*10 + temp_ones;
+                        /*******************************************************************************/   
+                        Refresh_Show(2, 5);
+                        keypad_value = GetKeyPressed(login_mode);
+                        __delay_ms(200);//to avoid the duplication of the pressed key
+                        
+                        if(timeout_flag == TRUE) //in case of the time is out before the user press a key
+                        {
+                            break;//break the loop that ask for temperature
+                        }
+                        if(keypad_value == NO_KEY_PRESSED)//the key answered the session warning, draw the prompt again
+                        {
+                            continue;
+                        }
+                        if(keypad_value != '0' && keypad_value != '5')//the setpoint steps are half a degree
+                        {
+                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//remove all previously printed characters on the LCD and move the cursor to the first column of the first row
+                            lcd_8bit_send_string(&LCD, "Enter 0 or 5");//print error message
+                            __delay_ms(500);//Halt the system for the given time in (ms)
+                            continue;//return to #while (temperature==0)#
+                        }
+                        else//if the value is valid
+                        {
+                            lcd_8bit_send_char_pos(&LCD, keypad_value, 1, 14);
+                            temp_tenths = keypad_value-ASCII_ZERO;//save the entered value
+                            keypad_value = NO_KEY_PRESSED;//set the key pressed to the default value
+                        }
+                        temperature = (uint16)temp_tens*100 + (uint16)temp_ones*10 + temp_tenths;
+                        if(temperature < SETPOINT_MIN || temperature > SETPOINT_MAX)//out of the range of the air conditioning
+                        {
+                            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                            lcd_8bit_send_string(&LCD, "Range 10.0-35.0");//print error message
+                            __delay_ms(500);//Halt the system for the given time in (ms)
+                            temperature = 0;//ask again
+                            continue;
+                        }
                         SPI_Transfer_data(SET_TEMPERATURE);//Send the code of set temperature
                         __delay_ms(200);//Halt the system to prevent write collision
-                        SPI_Transfer_data(temperature);//Send the code of set temperature
+                        SPI_Transfer_data((uint8)(temperature >> 8));//Send the temperature in tenths, high byte first
+                        __delay_ms(RESPONSE_BYTE_TIME);
+                        SPI_Transfer_data((uint8)temperature);
                         lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
                         lcd_8bit_send_string(&LCD, "Temperature Sent");
                         __delay_ms(500);//Halt the system for the given time in (ms)
@@ -493,37 +506,418 @@ int main()
 
 void TMR0_InterruptHandler(void)
 {
-    session_counter++;//increase the indicator of session time for every tick
+    uptime_ticks++;
+    if(uptime_ticks >= TICKS_PER_SECOND)
+    {
+        uptime_ticks = 0;
+        uptime_seconds++;
+        if(session_seconds_left > 0)
+        {
+            session_seconds_left--;
+        }
+    }
+    if((session_state == SESSION_ACTIVE) || (session_state == SESSION_WARNING))
+    {
+        if(session_idle_ticks > 0)
+        {
+            session_idle_ticks--;
+        }
+        if((session_idle_ticks == 0) || (session_seconds_left == 0))
+        {
+            session_state = SESSION_EXPIRED;
+        }
+        else if((session_idle_ticks <= ((uint16)SESSION_WARNING_TIME * TICKS_PER_SECOND)) || (session_seconds_left <= SESSION_WARNING_TIME))
+        {
+            session_state = SESSION_WARNING;//back to active by the next key only
+        }
+    }
+    if(refresh_ticks < 0xFF)
+    {
+        refresh_ticks++;
+    }
+}
+
+void Config_Load(void)
+{
+    uint16 value = ZERO_INIT;
+    uint8 admin_pass_status = PASS_NOT_SET;
+    uint8 guest_pass_status = PASS_NOT_SET;
+    uint8 credentials[CREDENTIALS_SIZE];//admin then guest password of an older version
+    uint8 admins_count = ZERO_INIT;
+    uint8 key_counter = ZERO_INIT;
+    uint8 admin_pin[PASS_SIZE];
+    uint8 guest_pin[PASS_SIZE];
+    user_entry_t admin = {.role = ADMIN, .pin_length = PASS_SIZE, .timeout = ADMIN_TIMEOUT};
+    user_entry_t guest = {.role = GUEST, .pin_length = PASS_SIZE, .timeout = GUEST_TIMEOUT};
+    event_log_entry_t entry;
+    config_store_init(Config_fields);
+    config_store_read(CONFIG_KEY_BOOT_COUNT, &value);
+    user_table_init((uint8)value ^ NewSalt());//salts of the users whose PIN is still in clear
+    user_table_count(ADMIN, &admins_count);
+    if(admins_count == 0)
+    {
+        //an older version kept both passwords in one A/B record, before that the status in the store
+        //or at fixed addresses and the passwords at fixed addresses
+        if(E_OK == config_store_record_load(&Credentials_record, credentials))
+        {
+            admin_pass_status = PASS_SET;
+            guest_pass_status = PASS_SET;
+        }
+        else
+        {
+            config_store_read(CONFIG_KEY_ADMIN_PASS_STATUS, &value);
+            admin_pass_status = (uint8)value;
+            if(PASS_SET != admin_pass_status)
+            {
+                EEPROM_ReadByte(ADMIN_PASS_STATUS_ADDRESS, &admin_pass_status);
+            }
+            config_store_read(CONFIG_KEY_GUEST_PASS_STATUS, &value);
+            guest_pass_status = (uint8)value;
+            if(PASS_SET != guest_pass_status)
+            {
+                EEPROM_ReadByte(GUEST_PASS_STATUS_ADDRESS, &guest_pass_status);
+            }
+            if((PASS_SET == admin_pass_status) && (PASS_SET == guest_pass_status))
+            {
+                EEPROM_ReadBlock(EEPROM_ADMIN_ADDRESS, &credentials[ADMIN_PASS_OFFSET], PASS_SIZE);
+                EEPROM_ReadBlock(EEPROM_GUEST_ADDRESS, &credentials[GUEST_PASS_OFFSET], PASS_SIZE);
+            }
+        }
+        if((PASS_SET == admin_pass_status) && (PASS_SET == guest_pass_status))
+        {
+            //the old passwords become the first two users, the guest first so a reset between leaves no admin and both are carried over again
+            for(key_counter = 0; key_counter < PASS_SIZE; key_counter++)
+            {
+                admin_pin[key_counter] = PinKeyCode(credentials[ADMIN_PASS_OFFSET + key_counter]);
+                guest_pin[key_counter] = PinKeyCode(credentials[GUEST_PASS_OFFSET + key_counter]);
+            }
+            user_table_set(FIRST_GUEST_USER, &guest, guest_pin, NewSalt());
+            user_table_set(FIRST_ADMIN_USER, &admin, admin_pin, NewSalt() + 1);
+            memset(admin_pin, 0, sizeof(admin_pin));
+            memset(guest_pin, 0, sizeof(guest_pin));
+        }
+        memset(credentials, 0, sizeof(credentials));
+        user_table_count(ADMIN, &admins_count);
+    }
+    if(admins_count != 0)//only once the users hold the PINs, a failed migration is tried again at the next boot
+    {
+        Legacy_Credentials_Erase();
+    }
+    config_store_read(CONFIG_KEY_FAILED_TRIES, &value);
+    pass_tries_count = (uint8)value;
+    config_store_read(CONFIG_KEY_LOCKOUT_LEVEL, &value);
+    lockout_level = (uint8)value;
+    config_store_read(CONFIG_KEY_LOCKOUT_REMAINING, &value);
+    lockout_remaining = value;
+    config_store_read(CONFIG_KEY_LOGIN_BLOCKED, &value);
+    if(value == TRUE)//blocked by an older version, it had a single lockout time
+    {
+        lockout_remaining = LOCKOUT_BASE_TIME;
+        config_store_write(CONFIG_KEY_LOCKOUT_REMAINING, lockout_remaining);
+        config_store_write(CONFIG_KEY_LOGIN_BLOCKED, FALSE);
+    }
+    lockout_second = Uptime_Seconds();//the countdown goes on from the saved time
+    //every boot starts the time of the next events from zero, the boot event holds its number
+    config_store_read(CONFIG_KEY_BOOT_COUNT, &value);
+    value++;
+    config_store_write(CONFIG_KEY_BOOT_COUNT, value);
+    config_store_flush();
+    entry.time = value;
+    entry.event = LOG_EVENT_BOOT;
+    entry.user = NO_MODE;
+    entry.device = LOG_DEVICE_NONE;
+    event_log_add(&entry);
+}
+
+void Legacy_Credentials_Erase(void)
+{
+    static const uint16 addresses[3] = {ADMIN_PASS_STATUS_ADDRESS, CREDENTIALS_SLOT_A_ADDRESS, CREDENTIALS_SLOT_B_ADDRESS};
+    static const uint8 sizes[3] = {LEGACY_PASSWORDS_SIZE, CREDENTIALS_COPY_SIZE, CREDENTIALS_COPY_SIZE};
+    uint8 erased[CREDENTIALS_COPY_SIZE];
+    uint8 area_counter = 0;
+    
+    //the passwords of the older versions stay in clear until they're written over, an erased copy fails its CRC
+    memset(erased, EEPROM_ERASED_BYTE, sizeof(erased));
+    for(area_counter = 0; area_counter < 3; area_counter++)
+    {
+        //queued after the users, so they're erased only once the users are written; every boot queues
+        //them again but the EEPROM queue drops the bytes already erased without a write cycle
+        if(E_OK != EEPROM_WriteBlock_Async(addresses[area_counter], erased, sizes[area_counter], NULL))
+        {
+            EEPROM_WriteBlock(addresses[area_counter], erased, sizes[area_counter]);//the queue is full, wait for room
+        }
+    }
+}
+
+uint32 Uptime_Seconds(void)
+{
+    uint32 seconds = 0;
+    do//the 4 bytes are read again if the timer interrupt changed them in the middle
+    {
+        seconds = uptime_seconds;
+    }while(seconds != uptime_seconds);
+    return seconds;
+}
+
+void Log_Event(const uint8 Event, const uint8 User, const uint8 Device)
+{
+    event_log_entry_t entry = {.time = Uptime_Seconds(), .event = Event, .user = User, .device = Device};
+    event_log_add(&entry);//one record queued to the EEPROM, it's written in the background
+}
+
+void Session_Start(const uint8 Timeout)
+{
+    session_idle_limit = (uint16)Timeout * TICKS_PER_SECOND;
+    session_warning_shown = FALSE;
+    TIMER0_INTERRUPT_DISABLE();//the 16-bit counters are written while the interrupt can't use them, a tick is served after
+    session_idle_ticks = session_idle_limit;
+    session_seconds_left = SESSION_MAX_TIME;
+    session_state = SESSION_ACTIVE;
+    TIMER0_INTERRUPT_ENABLE();
+}
+
+void Session_Touch(void)
+{
+    TIMER0_INTERRUPT_DISABLE();
+    if((session_state == SESSION_ACTIVE) || (session_state == SESSION_WARNING))
+    {
+        session_idle_ticks = session_idle_limit;
+        if((session_state == SESSION_WARNING) && (session_seconds_left > SESSION_WARNING_TIME))//the key only helps an idle ending
+        {
+            session_state = SESSION_ACTIVE;
+            session_warning_shown = FALSE;
+        }
+    }
+    TIMER0_INTERRUPT_ENABLE();
+}
+
+void Session_Close(void)
+{
+    session_state = SESSION_CLOSED;//a single byte, the interrupt stops counting at once
+}
+
+uint16 Session_SecondsLeft(void)
+{
+    uint16 seconds = 0;
+    
+    TIMER0_INTERRUPT_DISABLE();
+    seconds = session_seconds_left;
+    TIMER0_INTERRUPT_ENABLE();
+    return seconds;
+}
+
+void Lockout_Start(void)
+{
+    lockout_remaining = LOCKOUT_BASE_TIME << lockout_level;
+    lockout_second = Uptime_Seconds();
+    if(lockout_level < LOCKOUT_LEVEL_MAX)
+    {
+        lockout_level++;
+    }
+    pass_tries_count = 0;//the tries start again after the lockout
+    config_store_write(CONFIG_KEY_LOCKOUT_REMAINING, lockout_remaining);
+    config_store_write(CONFIG_KEY_LOCKOUT_LEVEL, lockout_level);
+    config_store_write(CONFIG_KEY_FAILED_TRIES, pass_tries_count);
+    config_store_flush();//queued now so a reset can't skip the block
+    Log_Event(LOG_EVENT_LOCKOUT, NO_MODE, LOG_DEVICE_NONE);
+}
+
+uint16 Lockout_Task(void)
+{
+    uint32 now = Uptime_Seconds();
+    uint32 elapsed = 0;//seconds since the last update
+    
+    if((lockout_remaining != 0) && (now != lockout_second))
+    {
+        elapsed = now - lockout_second;
+        lockout_second = now;
+        lockout_remaining = (elapsed >= lockout_remaining) ? 0 : (uint16)(lockout_remaining - elapsed);
+        //rounded up, the store appends a record only when the saved value changes, once every LOCKOUT_SAVE_PERIOD
+        config_store_write(CONFIG_KEY_LOCKOUT_REMAINING,
+                           ((lockout_remaining + LOCKOUT_SAVE_PERIOD - 1) / LOCKOUT_SAVE_PERIOD) * LOCKOUT_SAVE_PERIOD);
+    }
+    return lockout_remaining;
+}
+
+void ShowLockout(void)
+{
+    uint16 shown = 0;//the countdown on the screen
+    uint8 value_str[6] = {0};
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    lcd_8bit_send_string(&LCD, "Login blocked");
+    led_turn_on(&Block_led);
+    while(Lockout_Task() != 0)//the keys are ignored, the EEPROM writer keeps running
+    {
+        if(lockout_remaining != shown)//"wait 1280 s"
+        {
+            shown = lockout_remaining;
+            convert_uint16_to_string(shown, value_str);
+            lcd_8bit_send_string_pos(&LCD, "wait ", 2,1);
+            lcd_8bit_send_string(&LCD, value_str);
+            lcd_8bit_send_char(&LCD, 's');
+        }
+        config_store_task();//writes a changed setting when the EEPROM is idle
+    }
+    led_turn_off(&Block_led);
+}
+
+uint8 NewSalt(void)
+{
+    uint16 timer_value = 0;
+    
+    //Timer0 counts every instruction cycle, its value when a key is released is out of anyone's control
+    Timer0_Read(&timer, &timer_value);
+    return (uint8)(timer_value ^ (timer_value >> 8) ^ Uptime_Seconds());
+}
+
+uint8 PinKeyCode(const uint8 Key)
+{
+    static const uint8 other_keys[USER_PIN_CODES_NUM - 10] = {'/', '*', '-', '#', '=', '+'};
+    uint8 code = 0;//the digits are their own code, the other keys follow them
+    
+    if((Key >= '0') && (Key <= '9'))
+    {
+        code = Key - ASCII_ZERO;
+    }
+    else
+    {
+        for(code = 0; code < (USER_PIN_CODES_NUM - 10); code++)
+        {
+            if(other_keys[code] == Key)
+            {
+                break;
+            }
+        }
+        code += 10;//USER_PIN_CODES_NUM if the key isn't on the keypad, the user table refuses it
+    }
+    return code;
 }
 
-uint8 ComparePass(const uint8* pass1,const uint8* pass2,const uint8 size)
+uint8 GetPin(const uint8 LoginMode, const uint8 Length, uint8 *pin)
 {
-    uint8 Compare_Counter = ZERO_INIT;
-    uint8 retValue = TRUE;
-    for(Compare_Counter = 0; Compare_Counter < size; Compare_Counter++)
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 password_counter = 0;//counts the entered key of the password from the keypad
+    
+    lcd_8bit_send_string_pos(&LCD, "PIN:", 2,1);
+    for(password_counter = 0; password_counter < Length; password_counter++)
     {
-        if(pass1[Compare_Counter] != pass2[Compare_Counter])
+        key_pressed = GetKeyPressed(LoginMode);
+        if((timeout_flag == TRUE) || (key_pressed == NO_KEY_PRESSED))//the time is out or the key answered the session warning
         {
-            retValue = FALSE;
-            break;
+            return FALSE;
         }
+        pin[password_counter] = PinKeyCode(key_pressed);//the table keeps the code of the key
+        lcd_8bit_send_char(&LCD, key_pressed);
+        __delay_ms(CHARACTER_PREVIEW_TIME);//Halt the system for the given time in (ms)
+        lcd_8bit_send_char_pos(&LCD, PASSWORD_SYMBOL, 2, 5+password_counter);
+        __delay_ms(50);//Halt the system for the given time in (ms)
+    }
+    return TRUE;
+}
+
+uint8 EditUser(const uint8 Index, const uint8 Role, const uint8 LoginMode)
+{
+    user_entry_t user = {.role = Role};
+    uint8 pin[USER_PIN_MAX];//key codes of the new PIN
+    Std_ReturnType saved = E_NOT_OK;//the user is in the table
+    uint16 number = 0;
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    if(GetNumber(LoginMode, "PIN length 4-8:", 1, 1, &number) == FALSE)
+    {
+        return FALSE;
+    }
+    __delay_ms(200);//Halt the system for the given time in (ms)
+    if((number < USER_PIN_MIN) || (number > USER_PIN_MAX))
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return FALSE;
+    }
+    user.pin_length = (uint8)number;
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    lcd_8bit_send_string(&LCD, "User ");
+    lcd_8bit_send_char(&LCD, ASCII_ZERO + Index);
+    lcd_8bit_send_string(&LCD, (Role == ADMIN) ? " Admin" : " Guest");
+    if(GetPin(LoginMode, user.pin_length, pin) == FALSE)
+    {
+        return FALSE;
+    }
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    if(GetNumber(LoginMode, "Timeout s:", 1, TIMEOUT_DIGITS, &number) == FALSE)
+    {
+        return FALSE;
+    }
+    __delay_ms(200);//Halt the system for the given time in (ms)
+    if((number < USER_TIMEOUT_MIN) || (number > 0xFF))
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Range 10-255");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return FALSE;
+    }
+    user.timeout = (uint8)number;
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    saved = user_table_set(Index, &user, pin, NewSalt());//only this user is rewritten, the PIN is stored as a salted digest
+    memset(pin, 0, sizeof(pin));
+    if(E_OK != saved)
+    {
+        lcd_8bit_send_string(&LCD, "Not saved");
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return FALSE;
     }
-    return retValue;
+    lcd_8bit_send_string(&LCD, "User saved");
+    __delay_ms(500);//Halt the system for the given time in (ms)
+    return TRUE;
 }
 
 uint8 GetKeyPressed(const uint8 LoginMode)
 {
     uint8 key_pressed = NO_KEY_PRESSED;
+    uint8 warning_on_screen = FALSE;//the warning covers the screen of the caller
 	while (key_pressed == NO_KEY_PRESSED)//repeat till the user press any key
 	{
-		if ((session_counter >= ADMIN_TIMEOUT && LoginMode == ADMIN) || (session_counter >= GUEST_TIMEOUT && LoginMode == GUEST))//check for timeout
+		if ((LoginMode != NO_MODE) && (session_state >= SESSION_WARNING))//one byte set by the timer interrupt
 		{
-			timeout_flag = TRUE;//set timeout flag to true
-			break;//break the loop that wait for input from the user
+			if(session_state == SESSION_EXPIRED)
+			{
+				timeout_flag = TRUE;//set timeout flag to true
+				break;//break the loop that wait for input from the user
+			}
+			if(session_warning_shown == FALSE)
+			{
+				session_warning_shown = TRUE;
+				warning_on_screen = TRUE;
+				refresh_row = REFRESH_NO_FIELD;//the live temperature isn't drawn over the warning
+				lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+				lcd_8bit_send_string(&LCD, "Session ending");
+				if(Session_SecondsLeft() <= SESSION_WARNING_TIME)
+				{
+					lcd_8bit_send_string_pos(&LCD, "max time reached", 2,1);
+				}
+				else
+				{
+					lcd_8bit_send_string_pos(&LCD, "press any key", 2,1);
+				}
+			}
 		}
 		
-		key_pressed = keypad_get_value(&keypad);;//if the user pressed any button in keypad save the value in key_pressed
+		key_pressed = keypad_get_value(&keypad);//if the user pressed any button in keypad save the value in key_pressed
+		Refresh_Task();//one short step of the live temperature between two keypad scans
+		config_store_task();//writes a changed setting when the EEPROM is idle
+	}
+	if((key_pressed != NO_KEY_PRESSED) && (LoginMode != NO_MODE))
+	{
+		Session_Touch();//the idle timeout starts again
+		if(warning_on_screen == TRUE)
+		{
+			key_pressed = NO_KEY_PRESSED;//the key only answered the warning: a prompt is drawn and read again, a view goes back to its menu
+		}
 	}
+	Refresh_Flush();//the request in flight is completed before the caller talks to the slave
+	refresh_row = REFRESH_NO_FIELD;
 	return key_pressed;
 }
 
@@ -534,6 +928,10 @@ void MenuOption(const uint8 SelectedRoom, const uint8 LoginMode)
 	uint8 TurnOffCode = 0;//turn off the device or room
 	uint8 response    = DEFAULT_ACK;//the response of the slave that is sent back based on the command of the master
 	uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 max_option  = SELECT_TURN_OFF;//the last valid option of the shown menu
+    uint8 room        = 0;//the room number of the dimming commands
+    uint8 level       = 0;//the brightness level of the room
+    uint8 level_str[4] = {0};//the brightness percentage as a string
     
     do
     {
@@ -574,7 +972,7 @@ void MenuOption(const uint8 SelectedRoom, const uint8 LoginMode)
 			StatusCode = AIR_COND_STATUS;
 			TurnOnCode = AIR_COND_TURN_ON;
 			TurnOffCode = AIR_COND_TURN_OFF;
-			lcd_8bit_send_string(&LCD, "Air Cond. S:");
+			lcd_8bit_send_string(&LCD, "AC:");
 			break;
 		}
         /****************************************************************************************************/
@@ -591,23 +989,903 @@ void MenuOption(const uint8 SelectedRoom, const uint8 LoginMode)
 			lcd_8bit_send_string(&LCD, "OFF");
 		}
         
-        lcd_8bit_send_string_pos(&LCD, "1-On 2-Off 0-RET", 2,1);
+        if(SelectedRoom <= ROOM4_MENU)//the room lights are dimmable
+        {
+            room = SelectedRoom - ROOM1_MENU + 1;
+            SPI_Transfer_data(GET_LEVEL);//ask for the brightness of the room
+            __delay_ms(100);//Halt the system for the given time in (ms)
+            SPI_Transfer_data(room);
+            __delay_ms(100);//Halt the system for the given time in (ms)
+            level = SPI_Transfer_data(DEMAND_RESPONSE);
+            convert_uint8_to_string((uint8)(((uint16)level * 100) / MAX_LEVEL), level_str);
+            lcd_8bit_send_char(&LCD, ' ');
+            lcd_8bit_send_string(&LCD, level_str);
+            lcd_8bit_send_char(&LCD, '%');
+            lcd_8bit_send_string_pos(&LCD, "1On 2Off 3Lvl 0R", 2,1);
+            max_option = SELECT_LEVEL;
+        }
+        else
+        {
+            lcd_8bit_send_string_pos(&LCD, "1-On 2-Off 0-RET", 2,1);
+            max_option = SELECT_TURN_OFF;
+        }
+        if(SelectedRoom == AIRCOND_CTRL_MENU)
+        {
+            Refresh_Show(1, 8);//"AC:OFF 24.3/24.5"
+        }
         key_pressed = GetKeyPressed(LoginMode);
         /*there is no need to take any action in case of the user pressed 0(RET) key
 		breaking the loop will be enough since it will be handled in the main*/
-        if (key_pressed == '1')
+        if (key_pressed == SELECT_TURN_ON)
 		{
 			SPI_Transfer_data(TurnOnCode);//Send turn on signal from master to slave
+			Log_Event(LOG_EVENT_DEVICE_ON, LoginMode, TurnOnCode & LOG_DEVICE_MASK);
 		}
-		else if (key_pressed == '2')
+		else if (key_pressed == SELECT_TURN_OFF)
 		{
 			SPI_Transfer_data(TurnOffCode);//Send turn off signal from master to slave
+			Log_Event(LOG_EVENT_DEVICE_OFF, LoginMode, TurnOffCode & LOG_DEVICE_MASK);
 		}
-		else if( (key_pressed != NO_KEY_PRESSED) && (key_pressed != '0') )//show wrong input message if the user entered non numeric value
+        else if ((key_pressed == SELECT_LEVEL) && (max_option == SELECT_LEVEL))
+        {
+            SetRoomLevel(room, LoginMode);//ask for the brightness and send it to the slave
+        }
+		else if( (key_pressed != NO_KEY_PRESSED) && (key_pressed != SELECT_RET) )//show wrong input message if the user entered non numeric value
 		{
 			lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//remove all previously printed characters on the LCD and move the cursor to the first column of the first row
 			lcd_8bit_send_string(&LCD, "Wrong input");//print error message
 			__delay_ms(500);//Halt the system for the given time in (ms)
 		}
-    }while(((key_pressed < '0') || (key_pressed > '2')) && (timeout_flag == FALSE));
-}
\ No newline at end of file
+    }while(((key_pressed < SELECT_RET) || (key_pressed > max_option)) && (timeout_flag == FALSE));
+}
+
+void SetRoomLevel(const uint8 Room, const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 level = 0;//the brightness level to send
+    
+    do
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Level 0-9:");
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+    }while((key_pressed == NO_KEY_PRESSED) && (timeout_flag == FALSE));//the key answered the session warning
+    if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+    {
+        return;
+    }
+    if(key_pressed < '0' || key_pressed > '9')//show wrong input message if the user entered non numeric value
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+    }
+    else
+    {
+        level = (uint8)(((uint16)(key_pressed - ASCII_ZERO) * MAX_LEVEL) / LEVEL_STEPS);//scale the key to 0..255
+        SPI_Transfer_data(SET_LEVEL);//Send the code of set level
+        __delay_ms(100);//Halt the system to prevent write collision
+        SPI_Transfer_data(Room);//Send the room number
+        __delay_ms(100);//Halt the system to prevent write collision
+        SPI_Transfer_data(level);//Send the brightness
+        Log_Event(LOG_EVENT_LEVEL, LoginMode, Room);
+    }
+}
+
+void SetAirCondSpeed(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 speed = 0;//the fan speed in percent
+    uint8 speed_str[4] = {0};//the fan speed as a string
+    
+    SPI_Transfer_data(GET_AC_SPEED);//ask for the current fan speed
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    speed = SPI_Transfer_data(DEMAND_RESPONSE);
+    convert_uint8_to_string(speed, speed_str);
+    
+    do
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Speed:");
+        lcd_8bit_send_string(&LCD, speed_str);
+        lcd_8bit_send_char(&LCD, '%');
+        lcd_8bit_send_string_pos(&LCD, "New speed 0-9:", 2,1);
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+    }while((key_pressed == NO_KEY_PRESSED) && (timeout_flag == FALSE));//the key answered the session warning
+    if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+    {
+        return;
+    }
+    if(key_pressed < '0' || key_pressed > '9')//show wrong input message if the user entered non numeric value
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+    }
+    else
+    {
+        speed = (uint8)(((uint16)(key_pressed - ASCII_ZERO) * MAX_SPEED) / LEVEL_STEPS);//scale the key to 0..100
+        SPI_Transfer_data(SET_AC_SPEED);//Send the code of set speed
+        __delay_ms(100);//Halt the system to prevent write collision
+        SPI_Transfer_data(speed);//Send the speed
+    }
+}
+
+void ShowRoomsTemperature(const uint8 LoginMode)
+{
+    uint8 room_counter = 0;
+    uint8 temp_high = 0;//high byte of the temperature of a room
+    uint8 temp_low = 0;//low byte of the temperature of a room
+    sint16 rooms_temperature[ROOMS_NUM] = {0};//tenths of a degree
+    
+    SPI_Transfer_data(GET_ALL_TEMPS);//ask for the temperature of all rooms in one request
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)
+    {
+        temp_high = SPI_Transfer_data(DEMAND_RESPONSE);
+        __delay_ms(RESPONSE_BYTE_TIME);
+        temp_low = SPI_Transfer_data(DEMAND_RESPONSE);
+        __delay_ms(RESPONSE_BYTE_TIME);
+        rooms_temperature[room_counter] = (sint16)(((uint16)temp_high << 8) | temp_low);
+    }
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)//two rooms per row "1:25.3  2:24.8"
+    {
+        lcd_8bit_send_char_pos(&LCD, '1' + room_counter, (room_counter / 2) + 1, ((room_counter % 2) * 8) + 1);
+        lcd_8bit_send_char(&LCD, ':');
+        DisplayTenths(rooms_temperature[room_counter]);
+    }
+    GetKeyPressed(LoginMode);//keep the temperatures on the screen till any key is pressed
+    __delay_ms(200);//to avoid the duplication of the pressed key
+}
+
+void DisplayTenths(sint16 value)
+{
+    uint8 value_str[4] = {0};
+    
+    if(value < 0)
+    {
+        lcd_8bit_send_char(&LCD, '-');
+        value = -value;
+    }
+    convert_uint8_to_string((uint8)(value / 10), value_str);//the integer part
+    lcd_8bit_send_string(&LCD, value_str);
+    lcd_8bit_send_char(&LCD, '.');
+    lcd_8bit_send_char(&LCD, (uint8)(value % 10) + ASCII_ZERO);//the tenths digit
+}
+
+void SetThermostatControl(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 mode = 0;//control mode of the thermostat
+    uint8 gain_kp = 0;//percent per degree
+    uint8 gain_ki = 0;//percent per degree per minute
+    uint8 output = 0;//PI output in percent
+    uint8 value_str[4] = {0};
+    
+    SPI_Transfer_data(GET_CTRL_STATE);//ask for the current control state
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    mode = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    gain_kp = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    gain_ki = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    output = SPI_Transfer_data(DEMAND_RESPONSE);
+    
+    do
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//"M2 P20 I5 Y45%"
+        lcd_8bit_send_char(&LCD, 'M');
+        lcd_8bit_send_char(&LCD, mode + ASCII_ZERO);
+        lcd_8bit_send_string(&LCD, " P");
+        convert_uint8_to_string(gain_kp, value_str);
+        lcd_8bit_send_string(&LCD, value_str);
+        lcd_8bit_send_string(&LCD, " I");
+        convert_uint8_to_string(gain_ki, value_str);
+        lcd_8bit_send_string(&LCD, value_str);
+        lcd_8bit_send_string(&LCD, " Y");
+        convert_uint8_to_string(output, value_str);
+        lcd_8bit_send_string(&LCD, value_str);
+        lcd_8bit_send_char(&LCD, '%');
+        lcd_8bit_send_string_pos(&LCD, "0H1W2P 8Cal 9Pr", 2,1);
+        
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+    }while((key_pressed == NO_KEY_PRESSED) && (timeout_flag == FALSE));//the key answered the session warning
+    if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+    {
+        return;
+    }
+    if(key_pressed == SELECT_PROTECTION)
+    {
+        SetAirCondProtection(LoginMode);
+        return;
+    }
+    if(key_pressed == SELECT_CALIBRATION)
+    {
+        CalibrateRoomSensor(LoginMode);
+        return;
+    }
+    if(key_pressed < '0' || key_pressed >= (ASCII_ZERO + THERMOSTAT_MODES_NUM))//show wrong input message for an unknown mode
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return;
+    }
+    mode = key_pressed - ASCII_ZERO;
+    SPI_Transfer_data(SET_CTRL_MODE);//Send the code of set control mode
+    __delay_ms(100);//Halt the system to prevent write collision
+    SPI_Transfer_data(mode);//Send the mode
+    if(mode == 0)//the hysteresis mode has no gains
+    {
+        return;
+    }
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    if(GetTwoDigits(LoginMode, "Kp %/C:", 1, &gain_kp) == FALSE)
+    {
+        return;
+    }
+    if(GetTwoDigits(LoginMode, "Ki %/Cmin:", 2, &gain_ki) == FALSE)
+    {
+        return;
+    }
+    SPI_Transfer_data(SET_PI_GAINS);//Send the code of set gains
+    __delay_ms(100);//Halt the system to prevent write collision
+    SPI_Transfer_data(gain_kp);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    SPI_Transfer_data(gain_ki);
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    lcd_8bit_send_string(&LCD, "Gains Sent");
+    __delay_ms(500);//Halt the system for the given time in (ms)
+}
+
+void SetAirCondProtection(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 min_on = 0;//minimum on-time of the compressor in minutes
+    uint8 min_off = 0;//minimum off-time of the compressor in minutes
+    uint8 deadband = 0;//hysteresis band in tenths of a degree
+    uint16 lockout = 0;//seconds before the compressor may switch again
+    uint16 switch_count = 0;//starts and stops of the compressor
+    uint8 value_str[6] = {0};
+    
+    SPI_Transfer_data(GET_AC_PROTECT);//ask for the protection settings and statistics
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    min_on = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    min_off = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    deadband = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    lockout = (uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8;
+    __delay_ms(RESPONSE_BYTE_TIME);
+    lockout |= SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    switch_count = (uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8;
+    __delay_ms(RESPONSE_BYTE_TIME);
+    switch_count |= SPI_Transfer_data(DEMAND_RESPONSE);
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//"Lk:123  Sw:45   "
+    lcd_8bit_send_string(&LCD, "Lk:");
+    convert_uint16_to_string(lockout, value_str);
+    lcd_8bit_send_string(&LCD, value_str);
+    lcd_8bit_send_string(&LCD, "Sw:");
+    convert_uint16_to_string(switch_count, value_str);
+    lcd_8bit_send_string(&LCD, value_str);
+    lcd_8bit_send_string_pos(&LCD, "1:Edit  0:RET", 2,1);
+    
+    key_pressed = GetKeyPressed(LoginMode);
+    __delay_ms(200);//to avoid the duplication of the pressed key
+    if((timeout_flag == TRUE) || (key_pressed != SELECT_EDIT))
+    {
+        return;
+    }
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//"On3 Off5 Db10", the current values
+    lcd_8bit_send_string(&LCD, "On");
+    convert_uint8_to_string(min_on, value_str);
+    lcd_8bit_send_string(&LCD, value_str);
+    lcd_8bit_send_string(&LCD, " Off");
+    convert_uint8_to_string(min_off, value_str);
+    lcd_8bit_send_string(&LCD, value_str);
+    lcd_8bit_send_string(&LCD, " Db");
+    convert_uint8_to_string(deadband, value_str);
+    lcd_8bit_send_string(&LCD, value_str);
+    if(GetTwoDigits(LoginMode, "Min on min:", 2, &min_on) == FALSE)
+    {
+        return;
+    }
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    if(GetTwoDigits(LoginMode, "Min off min:", 1, &min_off) == FALSE)
+    {
+        return;
+    }
+    if(GetTwoDigits(LoginMode, "Band 0.1C:", 2, &deadband) == FALSE)
+    {
+        return;
+    }
+    if((min_on < AC_MIN_TIME_MIN) || (min_on > AC_MIN_TIME_MAX) || (min_off < AC_MIN_TIME_MIN) || (min_off > AC_MIN_TIME_MAX))
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Range 1-30 min");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return;
+    }
+    if((deadband < DEADBAND_MIN) || (deadband > DEADBAND_MAX))
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Band 0.2-5.0C");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return;
+    }
+    SPI_Transfer_data(SET_AC_PROTECT);//Send the code of set protection
+    __delay_ms(100);//Halt the system to prevent write collision
+    SPI_Transfer_data(min_on);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    SPI_Transfer_data(min_off);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    SPI_Transfer_data(deadband);
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    lcd_8bit_send_string(&LCD, "Settings Sent");
+    __delay_ms(500);//Halt the system for the given time in (ms)
+}
+
+void ShowTemperatureTrend(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 samples = 0;//samples in the stream
+    uint8 sample_counter = 0;
+    uint8 per_column = 0;//samples averaged in one bar
+    uint8 column_samples = 0;//samples added to the current bar
+    uint8 columns_num = 0;//bars drawn, the newest one on the right
+    uint8 column_counter = 0;
+    uint8 bar_height = 0;
+    uint8 row_counter = 0;
+    uint8 bar[8] = {0};//pattern of a custom character
+    sint16 value = 0;//temperature in tenths of a degree
+    sint16 columns[TREND_COLUMNS] = {0};//average of every bar
+    sint16 low = 0, high = 0;//range of the bars
+    sint32 column_sum = 0;
+    
+    SPI_Transfer_data(GET_TEMP_HISTORY);//ask for the history in one stream
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    SPI_Transfer_data(TREND_SAMPLES);
+    __delay_ms(100);//the slave walks the history to the first sample
+    samples = SPI_Transfer_data(DEMAND_RESPONSE);
+    for(sample_counter = 0; sample_counter < 5; sample_counter++)//the period and the time of the newest sample aren't shown
+    {
+        __delay_ms(STREAM_BYTE_TIME);
+        SPI_Transfer_data(DEMAND_RESPONSE);
+    }
+    if(samples == 0)
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "No history yet");
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return;
+    }
+    __delay_ms(STREAM_BYTE_TIME);
+    value = (sint16)((uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8);
+    __delay_ms(STREAM_BYTE_TIME);
+    value |= SPI_Transfer_data(DEMAND_RESPONSE);
+    
+    //the samples are averaged into the bars while they arrive, nothing else is buffered
+    per_column = (samples + TREND_COLUMNS - 1) / TREND_COLUMNS;
+    for(sample_counter = 0; sample_counter < samples; sample_counter++)
+    {
+        if(sample_counter > 0)
+        {
+            __delay_ms(STREAM_BYTE_TIME);
+            value += (sint8)SPI_Transfer_data(DEMAND_RESPONSE);
+        }
+        column_sum += value;
+        column_samples++;
+        if((column_samples == per_column) || (sample_counter == (samples - 1)))
+        {
+            columns[columns_num] = (sint16)(column_sum / column_samples);
+            columns_num++;
+            column_sum = 0;
+            column_samples = 0;
+        }
+    }
+    
+    low = columns[0];
+    high = columns[0];
+    for(column_counter = 1; column_counter < columns_num; column_counter++)
+    {
+        if(columns[column_counter] < low)
+        {
+            low = columns[column_counter];
+        }
+        if(columns[column_counter] > high)
+        {
+            high = columns[column_counter];
+        }
+    }
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    for(column_counter = 0; column_counter < columns_num; column_counter++)
+    {
+        if(high == low)//flat history, half height bars
+        {
+            bar_height = (TREND_BAR_ROWS + 1) / 2;
+        }
+        else
+        {
+            bar_height = 1 + (uint8)(((sint32)(columns[column_counter] - low) * (TREND_BAR_ROWS - 1)) / (high - low));
+        }
+        for(row_counter = 0; row_counter < TREND_BAR_ROWS; row_counter++)
+        {
+            bar[row_counter] = (row_counter >= (TREND_BAR_ROWS - bar_height)) ? 0x1F : 0x00;
+        }
+        lcd_8bit_send_custom_char(&LCD, bar, 2, TREND_COLUMNS - columns_num + column_counter + 1, bar_height - 1);
+    }
+    
+    //keys 1..3 show the statistics of the 1 min, 5 min and whole history windows
+    key_pressed = ASCII_ZERO + HISTORY_WINDOWS_NUM;
+    do
+    {
+        ShowHistoryStats(key_pressed - '1');
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+    }while((key_pressed >= '1') && (key_pressed < ('1' + HISTORY_WINDOWS_NUM)) && (timeout_flag == FALSE));
+}
+
+void ShowHistoryStats(const uint8 Window)
+{
+    uint8 samples = 0;//samples in the window
+    sint16 low = 0, high = 0, average = 0;//tenths of a degree
+    
+    SPI_Transfer_data(GET_TEMP_STATS);//ask for the statistics of a window
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    SPI_Transfer_data(Window);
+    __delay_ms(100);//Halt the system for the given time in (ms)
+    samples = SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    low = (sint16)((uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    low |= SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    high = (sint16)((uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    high |= SPI_Transfer_data(DEMAND_RESPONSE);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    average = (sint16)((uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8);
+    __delay_ms(RESPONSE_BYTE_TIME);
+    average |= SPI_Transfer_data(DEMAND_RESPONSE);
+    
+    lcd_8bit_send_string_pos(&LCD, "                ", 1,1);//clear the first row only, the bars stay
+    lcd_8bit_send_cmd(&LCD, LCD_DDRAM_START);
+    if(samples == 0)
+    {
+        lcd_8bit_send_string(&LCD, "No samples");
+        return;
+    }
+    DisplayTenths(low);//"22.1-25.3 av24.0"
+    lcd_8bit_send_char(&LCD, '-');
+    DisplayTenths(high);
+    lcd_8bit_send_string(&LCD, " av");
+    DisplayTenths(average);
+}
+
+void Refresh_Show(const uint8 Row, const uint8 Column)
+{
+    refresh_row = Row;
+    refresh_column = Column;
+    if(refresh_state == REFRESH_IDLE)
+    {
+        refresh_ticks = REFRESH_PERIOD_TICKS;//the first request goes out on the next step
+    }
+}
+
+void Refresh_Task(void)
+{
+    if((refresh_row == REFRESH_NO_FIELD) && (refresh_state == REFRESH_IDLE))//nothing to show and nothing in flight
+    {
+        return;
+    }
+    if(refresh_state == REFRESH_IDLE)
+    {
+        if(refresh_ticks >= REFRESH_PERIOD_TICKS)
+        {
+            refresh_ticks = 0;
+            refresh_index = 0;
+            SPI_Transfer_data(GET_TEMPERATURE);//only the request byte, the response is collected in later steps
+            refresh_state = REFRESH_RESPONSE;
+        }
+        return;
+    }
+    if(refresh_ticks < REFRESH_RESPONSE_TICKS)//the slave is still loading the next byte
+    {
+        return;
+    }
+    refresh_ticks = 0;
+    refresh_response[refresh_index] = SPI_Transfer_data(DEMAND_RESPONSE);
+    refresh_index++;
+    if(refresh_index < REFRESH_RESPONSE_BYTES)
+    {
+        return;
+    }
+    refresh_state = REFRESH_IDLE;
+    if(refresh_row != REFRESH_NO_FIELD)//"24.3/24.5"
+    {
+        lcd_8bit_send_string_pos(&LCD, "         ", refresh_row, refresh_column);
+        lcd_8bit_send_string_pos(&LCD, "", refresh_row, refresh_column);
+        DisplayTenths((sint16)(((uint16)refresh_response[0] << 8) | refresh_response[1]));
+        lcd_8bit_send_char(&LCD, '/');
+        DisplayTenths((sint16)(((uint16)refresh_response[2] << 8) | refresh_response[3]));
+    }
+}
+
+void Refresh_Flush(void)
+{
+    while(refresh_state != REFRESH_IDLE)//at most REFRESH_RESPONSE_BYTES * REFRESH_RESPONSE_TICKS
+    {
+        Refresh_Task();
+    }
+}
+
+uint8 GetTwoDigits(const uint8 LoginMode, uint8 *Prompt, const uint8 Row, uint8 *value)
+{
+    uint16 number = 0;
+    
+    if(GetNumber(LoginMode, Prompt, Row, 2, &number) == FALSE)
+    {
+        return FALSE;
+    }
+    *value = (uint8)number;
+    return TRUE;
+}
+
+uint8 GetNumber(const uint8 LoginMode, uint8 *Prompt, const uint8 Row, const uint8 DigitsNum, uint16 *value)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 digit_counter = 0;
+    uint16 number = 0;
+    uint8 digit_shown = 0;
+    uint16 divisor = 0;//weight of the first digit to draw again
+    
+    lcd_8bit_send_string_pos(&LCD, Prompt, Row, 1);
+    while(digit_counter < DigitsNum)
+    {
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+        if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+        {
+            return FALSE;
+        }
+        if(key_pressed == NO_KEY_PRESSED)//the key answered the session warning, draw the prompt and the digits again
+        {
+            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+            lcd_8bit_send_string_pos(&LCD, Prompt, Row, 1);
+            divisor = 1;
+            for(digit_shown = 1; digit_shown < digit_counter; digit_shown++)//the leading zeros are drawn too
+            {
+                divisor *= 10;
+            }
+            while((digit_counter > 0) && (divisor > 0))
+            {
+                lcd_8bit_send_char(&LCD, (uint8)((number / divisor) % 10) + ASCII_ZERO);
+                divisor /= 10;
+            }
+            continue;
+        }
+        if(key_pressed < '0' || key_pressed > '9')//show wrong input message if the user entered non numeric value
+        {
+            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+            lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+            __delay_ms(500);//Halt the system for the given time in (ms)
+            return FALSE;
+        }
+        lcd_8bit_send_char(&LCD, key_pressed);//echo the digit at the cursor
+        number = (number * 10) + (key_pressed - ASCII_ZERO);
+        digit_counter++;
+    }
+    *value = number;
+    return TRUE;
+}
+
+void CalibrateRoomSensor(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 room = 0;//room of the calibrated sensor, 1 based
+    uint8 point = 0;//reference point, 0 or 1
+    uint16 gain = 0;//Q2.14
+    uint16 gain_thousandths = 0;//the gain shown as x.xxx
+    sint16 offset = 0;//tenths of a degree
+    uint16 reference = 0;//reference temperature in tenths of a degree
+    uint8 response = 0;
+    uint8 value_str[6] = {0};
+    
+    do
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Cal. room 1-4:");
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+    }while((key_pressed == NO_KEY_PRESSED) && (timeout_flag == FALSE));//the key answered the session warning
+    if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+    {
+        return;
+    }
+    if(key_pressed < '1' || key_pressed > (ASCII_ZERO + ROOMS_NUM))//show wrong input message for an unknown room
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+        __delay_ms(500);//Halt the system for the given time in (ms)
+        return;
+    }
+    room = key_pressed - ASCII_ZERO;
+    
+    while(timeout_flag == FALSE)//one action per pass till an unknown key is pressed
+    {
+        SPI_Transfer_data(GET_CALIB);//ask for the calibration of the room
+        __delay_ms(100);//Halt the system to prevent write collision
+        SPI_Transfer_data(room);
+        __delay_ms(RESPONSE_BYTE_TIME);
+        gain = (uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8;
+        __delay_ms(RESPONSE_BYTE_TIME);
+        gain |= SPI_Transfer_data(DEMAND_RESPONSE);
+        __delay_ms(RESPONSE_BYTE_TIME);
+        offset = (sint16)((uint16)SPI_Transfer_data(DEMAND_RESPONSE) << 8);
+        __delay_ms(RESPONSE_BYTE_TIME);
+        offset |= SPI_Transfer_data(DEMAND_RESPONSE);
+        
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//"G1.023 O-1.2"
+        gain_thousandths = (uint16)((((uint32)gain * 1000) + (1U << (CALIB_GAIN_SHIFT - 1))) >> CALIB_GAIN_SHIFT);
+        lcd_8bit_send_char(&LCD, 'G');
+        lcd_8bit_send_char(&LCD, (uint8)(gain_thousandths / 1000) + ASCII_ZERO);
+        lcd_8bit_send_char(&LCD, '.');
+        convert_uint16_to_string((gain_thousandths % 1000) + 1000, value_str);//the leading 1 keeps the zeros
+        value_str[4] = '\0';//drop the padding
+        lcd_8bit_send_string(&LCD, &value_str[1]);
+        lcd_8bit_send_string(&LCD, " O");
+        DisplayTenths(offset);
+        lcd_8bit_send_string_pos(&LCD, "1Pt 2Save 3Rst", 2,1);
+        
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+        if(timeout_flag == TRUE)//in case of the time is out before the user press a key
+        {
+            return;
+        }
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        switch(key_pressed)
+        {
+            case SELECT_CALIB_POINT:
+                //the room must sit at the reference temperature when the point is sent
+                if(GetNumber(LoginMode, "Point 0/1:", 1, 1, &reference) == FALSE)
+                {
+                    return;
+                }
+                point = (uint8)reference;
+                if(point >= CALIB_POINTS_NUM)
+                {
+                    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                    lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+                    __delay_ms(500);//Halt the system for the given time in (ms)
+                    break;
+                }
+                if(GetNumber(LoginMode, "Ref 0.1C:", 2, CALIB_REF_DIGITS, &reference) == FALSE)
+                {
+                    return;
+                }
+                SPI_Transfer_data(CALIB_POINT);//Send the code of a calibration point
+                __delay_ms(100);//Halt the system to prevent write collision
+                SPI_Transfer_data(room);
+                __delay_ms(RESPONSE_BYTE_TIME);
+                SPI_Transfer_data(point);
+                __delay_ms(RESPONSE_BYTE_TIME);
+                SPI_Transfer_data((uint8)(reference >> 8));
+                __delay_ms(RESPONSE_BYTE_TIME);
+                SPI_Transfer_data((uint8)reference);
+                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                lcd_8bit_send_string(&LCD, "Point Sent");
+                __delay_ms(500);//Halt the system for the given time in (ms)
+                break;
+            case SELECT_CALIB_SAVE:
+                SPI_Transfer_data(CALIB_APPLY);//compute the calibration from both points and store it
+                __delay_ms(100);//Halt the system to prevent write collision
+                SPI_Transfer_data(room);
+                __delay_ms(RESPONSE_BYTE_TIME);
+                response = SPI_Transfer_data(DEMAND_RESPONSE);
+                if(response == CALIB_DONE)
+                {
+                    lcd_8bit_send_string(&LCD, "Calibrated");
+                }
+                else if(response == CALIB_NOT_SAVED)
+                {
+                    lcd_8bit_send_string(&LCD, "Cal. not saved");//the EEPROM is busy, save again
+                }
+                else
+                {
+                    lcd_8bit_send_string(&LCD, "Cal. failed");//a point is missing or they are too close
+                }
+                __delay_ms(500);//Halt the system for the given time in (ms)
+                break;
+            case SELECT_CALIB_RESET:
+                SPI_Transfer_data(CALIB_RESET);//back to the ideal sensor
+                __delay_ms(100);//Halt the system to prevent write collision
+                SPI_Transfer_data(room);
+                lcd_8bit_send_string(&LCD, "Cal. reset");
+                __delay_ms(500);//Halt the system for the given time in (ms)
+                break;
+            case NO_KEY_PRESSED://the key answered the session warning, the screen is drawn again
+                break;
+            default:
+                return;
+        }
+    }
+}
+
+void ShowEventLog(const uint8 LoginMode)
+{
+    static const uint8 *event_names[LOG_EVENTS_NUM] = {"Boot", "Login", "Login failed", "Lockout",
+                                                       "Timeout", "Turned on", "Turned off", "Level set"};
+    static const uint8 user_letters[4] = {'-', 'A', 'G', '?'};
+    static const uint8 *device_names[8] = {"", "R1", "R2", "R3", "R4", "TV", "AC", "?"};
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 count = 0;//events in the log
+    uint8 age = 0;//shown event, 0 is the newest one
+    uint8 line[17] = {0};//one LCD row
+    uint32 hours = 0;
+    event_log_entry_t entry;
+    
+    lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+    lcd_8bit_send_string(&LCD, "1:Older 3:Newer");
+    lcd_8bit_send_string_pos(&LCD, "0:RET", 2,1);
+    __delay_ms(1000);//Halt the system for the given time in (ms)
+    event_log_get_count(&count);
+    do
+    {
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+        if(count == 0)
+        {
+            lcd_8bit_send_string(&LCD, "Log empty");
+        }
+        else if(E_OK == event_log_read(age, &entry))//one page per event, the record is read when it's shown
+        {
+            //"001 Login failed"
+            line[0] = ASCII_ZERO + ((age + 1) / 100);
+            line[1] = ASCII_ZERO + (((age + 1) / 10) % 10);
+            line[2] = ASCII_ZERO + ((age + 1) % 10);
+            line[3] = '\0';
+            lcd_8bit_send_string(&LCD, line);
+            lcd_8bit_send_char(&LCD, ' ');
+            lcd_8bit_send_string(&LCD, (entry.event < LOG_EVENTS_NUM) ? (uint8 *)event_names[entry.event] : (uint8 *)"?");
+            if(entry.event == LOG_EVENT_BOOT)
+            {
+                //"Boot no. 12"
+                lcd_8bit_send_string_pos(&LCD, "Boot no.", 2, 1);
+                convert_uint16_to_string((uint16)entry.time, line);
+                lcd_8bit_send_string(&LCD, line);
+            }
+            else
+            {
+                //"A 0001:02:03 R1", hours:minutes:seconds since the boot
+                hours = entry.time / SECONDS_PER_HOUR;
+                line[0] = user_letters[entry.user];
+                line[1] = ' ';
+                line[2] = ASCII_ZERO + (uint8)((hours / 1000) % 10);
+                line[3] = ASCII_ZERO + (uint8)((hours / 100) % 10);
+                line[4] = ASCII_ZERO + (uint8)((hours / 10) % 10);
+                line[5] = ASCII_ZERO + (uint8)(hours % 10);
+                line[6] = ':';
+                line[7] = ASCII_ZERO + (uint8)((entry.time / 600) % 6);
+                line[8] = ASCII_ZERO + (uint8)((entry.time / SECONDS_PER_MINUTE) % 10);
+                line[9] = ':';
+                line[10] = ASCII_ZERO + (uint8)((entry.time % SECONDS_PER_MINUTE) / 10);
+                line[11] = ASCII_ZERO + (uint8)(entry.time % 10);
+                line[12] = ' ';
+                line[13] = '\0';
+                lcd_8bit_send_string_pos(&LCD, line, 2, 1);
+                lcd_8bit_send_string(&LCD, (uint8 *)device_names[entry.device]);
+            }
+        }
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(50);//to avoid the duplication of the pressed key
+        if((key_pressed == SELECT_LOG_OLDER) && ((uint8)(age + 1) < count))
+        {
+            age++;
+        }
+        else if((key_pressed == SELECT_LOG_NEWER) && (age > 0))
+        {
+            age--;
+        }
+    }while((key_pressed != SELECT_RET) && (timeout_flag == FALSE));
+}
+
+void ManageUsers(const uint8 LoginMode)
+{
+    uint8 key_pressed = NO_KEY_PRESSED;//the key that is entered by the user
+    uint8 index = 0;//shown user
+    uint8 role = NO_MODE;//role of a changed user
+    uint8 value_str[4] = {0};
+    user_entry_t user;
+    
+    do
+    {
+        user_table_get(index, &user);
+        lcd_8bit_send_cmd(&LCD, LCD_CLEAR);//"U0 Admin 4d 60s"
+        lcd_8bit_send_char(&LCD, 'U');
+        lcd_8bit_send_char(&LCD, ASCII_ZERO + index);
+        if(user.role == NO_MODE)
+        {
+            lcd_8bit_send_string(&LCD, " free");
+        }
+        else
+        {
+            lcd_8bit_send_string(&LCD, (user.role == ADMIN) ? " Admin " : " Guest ");
+            lcd_8bit_send_char(&LCD, ASCII_ZERO + user.pin_length);
+            lcd_8bit_send_string(&LCD, "d ");
+            convert_uint8_to_string(user.timeout, value_str);
+            lcd_8bit_send_string(&LCD, value_str);
+            lcd_8bit_send_char(&LCD, 's');
+        }
+        lcd_8bit_send_string_pos(&LCD, "1Nx 2Set 3Del 0R", 2,1);
+        
+        key_pressed = GetKeyPressed(LoginMode);
+        __delay_ms(200);//to avoid the duplication of the pressed key
+        if(key_pressed == SELECT_USER_NEXT)
+        {
+            index = (index + 1) % USER_TABLE_USERS_NUM;
+        }
+        else if(key_pressed == SELECT_USER_SET)//adds the user or replaces it
+        {
+            do
+            {
+                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                lcd_8bit_send_string(&LCD, "Role:");
+                lcd_8bit_send_string_pos(&LCD, "1:Admin 2:Guest", 2,1);
+                key_pressed = GetKeyPressed(LoginMode);
+                __delay_ms(200);//to avoid the duplication of the pressed key
+            }while((key_pressed == NO_KEY_PRESSED) && (timeout_flag == FALSE));//the key answered the session warning
+            role = (key_pressed == SELECT_ROLE_ADMIN) ? ADMIN : ((key_pressed == SELECT_ROLE_GUEST) ? GUEST : NO_MODE);
+            if(timeout_flag == TRUE)
+            {
+                break;
+            }
+            else if(role == NO_MODE)
+            {
+                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                lcd_8bit_send_string(&LCD, "Wrong input");//print error message
+                __delay_ms(500);//Halt the system for the given time in (ms)
+            }
+            else if((index == login_user) && (role != user.role))//the logged in admin keeps an admin in the table
+            {
+                lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+                lcd_8bit_send_string(&LCD, "User logged in");
+                __delay_ms(500);//Halt the system for the given time in (ms)
+            }
+            else if((EditUser(index, role, LoginMode) == TRUE) && (index == login_user))
+            {
+                user_table_get(index, &user);
+                session_idle_limit = (uint16)user.timeout * TICKS_PER_SECOND;//the new timeout applies from the next key
+            }
+            key_pressed = NO_KEY_PRESSED;//stay on the shown user
+        }
+        else if(key_pressed == SELECT_USER_REMOVE)
+        {
+            lcd_8bit_send_cmd(&LCD, LCD_CLEAR);
+            if(index == login_user)
+            {
+                lcd_8bit_send_string(&LCD, "User logged in");
+            }
+            else if(user.role == NO_MODE)
+            {
+                lcd_8bit_send_string(&LCD, "User is free");
+            }
+            else
+            {
+                user_table_remove(index);
+                lcd_8bit_send_string(&LCD, "User removed");
+            }
+            __delay_ms(500);//Halt the system for the given time in (ms)
+        }
+    }while((key_pressed != SELECT_RET) && (timeout_flag == FALSE));
+}
@@ -16,21 +16,21 @@
 #define NOT_STORED   0xFF
 #define NOT_SELECTED 0xFF
 
-#define BLOCK_MODE_TIME		   (uint32)20000
 #define CHARACTER_PREVIEW_TIME (uint16)500
 #define DEGREES_SYMBOL		   (uint8)0xDF
 
 /************************************ Login configurations *****************************/
-#define NO_MODE (uint8)0
-#define ADMIN   (uint8)1
-#define GUEST   (uint8)2
+/* The login mode is the role of the logged in user */
+#define NO_MODE USER_ROLE_NONE
+#define ADMIN   USER_ROLE_ADMIN
+#define GUEST   USER_ROLE_GUEST
 
 /************************************ Logic values *************************************/
 #define FALSE   (uint8)0
 #define TRUE    (uint8)1
 
 /*********************************** PIN Configuration ***********************************/
-#define PASS_SIZE       (uint8)4
+#define PASS_SIZE       (uint8)4 //length of the passwords before the user table
 #define TRIES_ALLOWED   (uint8)3
 #define PASSWORD_SYMBOL (uint8)'*'
 #define ASCII_ZERO      (uint8)'0'
@@ -38,18 +38,56 @@
 #define PASS_NOT_SET (uint8)0xFF
 #define PASS_SET     (uint8)0x01
 
-#define ADMIN_PASS_STATUS_ADDRESS (uint16)0X10
-#define GUEST_PASS_STATUS_ADDRESS (uint16)0X11
+/* Every lockout in a row (no login between) lasts twice the previous one, the remaining time is
+   saved rounded up to LOCKOUT_SAVE_PERIOD, so a reset can't shorten it */
+#define LOCKOUT_BASE_TIME   (uint16)20 //seconds of the first lockout
+#define LOCKOUT_LEVEL_MAX   (uint8)6   //the lockouts stop growing at LOCKOUT_MAX_TIME
+#define LOCKOUT_MAX_TIME    (uint16)(LOCKOUT_BASE_TIME << LOCKOUT_LEVEL_MAX)
+#define LOCKOUT_SAVE_PERIOD (uint8)10
+
+/* Both passwords were kept in one A/B record of the configuration store before the user table, read once to carry them over */
+#define CREDENTIALS_SIZE           (uint8)(2 * PASS_SIZE)
+#define ADMIN_PASS_OFFSET          (uint8)0
+#define GUEST_PASS_OFFSET          PASS_SIZE
+#define CREDENTIALS_SLOT_A_ADDRESS (uint16)0x40 //every copy is CREDENTIALS_SIZE + 4 bytes
+#define CREDENTIALS_SLOT_B_ADDRESS (uint16)0x50
+#define CREDENTIALS_COPY_SIZE      (uint8)(CREDENTIALS_SIZE + 4)
+
+/* Fixed addresses of the passwords and the flags before the configuration store, read once to carry their values over */
 #define EEPROM_ADMIN_ADDRESS      (uint16)0X12
 #define EEPROM_GUEST_ADDRESS      (uint16)0X16
+#define ADMIN_PASS_STATUS_ADDRESS (uint16)0X10
+#define GUEST_PASS_STATUS_ADDRESS (uint16)0X11
 #define LOGIN_BLOCKED_ADDRESS     (uint16)0X28
-/****************************   number of ticks to run timeout ***************************/
-#define ADMIN_TIMEOUT (uint16)6000
-#define GUEST_TIMEOUT (uint16)3000
+#define LEGACY_PASSWORDS_SIZE     (uint8)(2 + CREDENTIALS_SIZE) //both flags then both passwords, 0x10 .. 0x19
+#define EEPROM_ERASED_BYTE        (uint8)0xFF
+
+/* Keys of the configuration store, the pass status and the login blocked keys are only read to carry the values of an older version over */
+#define CONFIG_KEY_ADMIN_PASS_STATUS (uint8)0
+#define CONFIG_KEY_GUEST_PASS_STATUS (uint8)1
+#define CONFIG_KEY_LOGIN_BLOCKED     (uint8)2
+#define CONFIG_KEY_BOOT_COUNT        (uint8)3
+#define CONFIG_KEY_LOCKOUT_LEVEL     (uint8)4
+#define CONFIG_KEY_LOCKOUT_REMAINING (uint8)5
+#define CONFIG_KEY_FAILED_TRIES      (uint8)6
+/****************************   session timeout in seconds of the first users ***************************/
+#define ADMIN_TIMEOUT (uint8)60
+#define GUEST_TIMEOUT (uint8)30
+#define FIRST_ADMIN_USER (uint8)0 //users set at the first login, the passwords of an older version go to them too
+#define FIRST_GUEST_USER (uint8)1
+#define TIMEOUT_DIGITS   (uint8)3 //session timeout of a user in seconds, 010 .. 255
+
+/****************************   Session  ***************************/
+/* The idle timeout of the user starts again on every key, a session never lasts more than SESSION_MAX_TIME.
+   The timer interrupt counts both down and sets the state, the menus only read that byte */
+#define SESSION_MAX_TIME     (uint16)1800 //seconds
+#define SESSION_WARNING_TIME (uint8)5     //seconds before the end of the session the warning is shown
+#define SESSION_CLOSED       (uint8)0
+#define SESSION_ACTIVE       (uint8)1
+#define SESSION_WARNING      (uint8)2
+#define SESSION_EXPIRED      (uint8)3
 
 /************************************ imp checks *************************************/
-#define ADMIN_MODE        (uint8)'0'
-#define GUEST_MODE        (uint8)'1'
 
 #define SELECT_ROOM1            (uint8)'1'
 #define SELECT_ROOM2            (uint8)'2'
@@ -61,9 +99,26 @@
 #define SELECT_TV               (uint8)'2'
 #define SELECT_AIR_CONDITIONING (uint8)'3'
 #define ADMIN_RET_OPTION        (uint8)'4'
+#define SELECT_EVENT_LOG        (uint8)'5'
+#define SELECT_USERS            (uint8)'6'
+
+#define SELECT_USER_NEXT        (uint8)'1'
+#define SELECT_USER_SET         (uint8)'2'
+#define SELECT_USER_REMOVE      (uint8)'3'
+#define SELECT_ROLE_ADMIN       (uint8)'1'
+#define SELECT_ROLE_GUEST       (uint8)'2'
+
+#define SELECT_TURN_ON          (uint8)'1'
+#define SELECT_TURN_OFF         (uint8)'2'
+#define SELECT_LEVEL            (uint8)'3'
+#define SELECT_RET              (uint8)'0'
 
 #define SELECT_SET_TEMPERATURE  (uint8)'1'
 #define SELECT_AIR_COND_CTRL    (uint8)'2'
+#define SELECT_AIR_COND_SPEED   (uint8)'3'
+#define SELECT_ROOMS_TEMP       (uint8)'4'
+#define SELECT_THERMOSTAT       (uint8)'5'
+#define SELECT_TREND            (uint8)'6'
 #define SELECT_AIR_COND_RET     (uint8)'0'
 
 /****************************   Show menu codes  *****************************************/
@@ -77,6 +132,31 @@
 #define AIRCONDITIONING_MENU (uint8)8
 #define AIRCOND_CTRL_MENU    (uint8)9
 #define TEMPERATURE_MENU     (uint8)10
+#define AIRCOND_SPEED_MENU   (uint8)11
+#define ROOMS_TEMP_MENU      (uint8)12
+#define THERMOSTAT_MENU      (uint8)13
+#define TREND_MENU           (uint8)14
+#define EVENT_LOG_MENU       (uint8)15
+#define USERS_MENU           (uint8)16
+
+/****************************   Event log  *****************************************/
+/* Times are seconds since the last boot event, whose time field holds the boot number instead */
+#define LOG_EVENT_BOOT          (uint8)0
+#define LOG_EVENT_LOGIN         (uint8)1
+#define LOG_EVENT_LOGIN_FAIL    (uint8)2
+#define LOG_EVENT_LOCKOUT       (uint8)3
+#define LOG_EVENT_TIMEOUT       (uint8)4
+#define LOG_EVENT_DEVICE_ON     (uint8)5
+#define LOG_EVENT_DEVICE_OFF    (uint8)6
+#define LOG_EVENT_LEVEL         (uint8)7
+#define LOG_EVENTS_NUM          (uint8)8
+#define LOG_DEVICE_NONE         (uint8)0
+#define LOG_DEVICE_MASK         (uint8)0x0F //rooms 1..4, TV 5 and air conditioning 6 as in the low nibble of the on/off codes
+#define SELECT_LOG_OLDER        (uint8)'1'
+#define SELECT_LOG_NEWER        (uint8)'3'
+#define TICKS_PER_SECOND        (uint8)100  //Timer0 ticks (10 ms) in a second
+#define SECONDS_PER_MINUTE      (uint8)60
+#define SECONDS_PER_HOUR        (uint16)3600
 
 /****************************   Std msgs  *****************************************/
 #define ROOM1_STATUS    0x11
@@ -85,6 +165,7 @@
 #define ROOM4_STATUS    0x14
 #define TV_STATUS 		0x15
 #define AIR_COND_STATUS 0x16
+#define DEVICES_STATUS  0x17
 
 #define ROOM1_TURN_ON    0x21
 #define ROOM2_TURN_ON    0x22
@@ -101,12 +182,85 @@
 #define AIR_COND_TURN_OFF 0x36
 
 #define SET_TEMPERATURE 0x40
+#define GET_TEMPERATURE 0x41
+#define GET_ALL_TEMPS   0x42
+#define GET_SCAN_RATE   0x43
+#define GET_TEMP_HISTORY 0x44
+#define GET_TEMP_STATS  0x45
+#define CALIB_POINT     0x46
+#define CALIB_APPLY     0x47
+#define CALIB_RESET     0x48
+#define GET_CALIB       0x49
+
+#define SET_CTRL_MODE   0x60
+#define SET_PI_GAINS    0x61
+#define GET_CTRL_STATE  0x62
+#define SET_AC_PROTECT  0x63
+#define GET_AC_PROTECT  0x64
+
+#define SET_SCENE       0x50
+#define SET_LEVEL       0x51
+#define GET_LEVEL       0x52
+#define GET_PWM_LOAD    0x53
+#define SET_AC_SPEED    0x54
+#define GET_AC_SPEED    0x55
+#define GET_CONVERT_LOAD 0x56
 
 #define DEFAULT_ACK    0xFF
 #define DEMAND_RESPONSE 0xFF
 
+#define MAX_LEVEL   (uint8)255
+#define LEVEL_STEPS (uint8)9 //keys 0..9 select the brightness from off to full
+#define MAX_SPEED   (uint8)100 //air conditioning fan speed in percent
+
+#define ROOMS_NUM           (uint8)4 //rooms with a temperature sensor on the slave
+#define RESPONSE_BYTE_TIME  (uint16)10 //time in (ms) for the slave to load the next byte of a response
+
+#define SETPOINT_MIN         (uint16)100 //required temperature range in tenths of a degree
+#define SETPOINT_MAX         (uint16)350
+#define THERMOSTAT_MODES_NUM (uint8)3 //0: hysteresis, 1: time-proportioned window, 2: fan PWM
+#define SELECT_PROTECTION    (uint8)'9' //compressor protection screen from the thermostat screen
+#define AC_MIN_TIME_MIN      (uint8)1  //range of the minimum on/off times in minutes, the slave ignores a set out of it
+#define AC_MIN_TIME_MAX      (uint8)30
+#define DEADBAND_MIN         (uint8)2  //range of the deadband in tenths of a degree
+#define DEADBAND_MAX         (uint8)50
+#define SELECT_EDIT          (uint8)'1'
+#define SELECT_CALIBRATION   (uint8)'8' //sensor calibration screen from the thermostat screen
+#define SELECT_CALIB_POINT   (uint8)'1'
+#define SELECT_CALIB_SAVE    (uint8)'2'
+#define SELECT_CALIB_RESET   (uint8)'3'
+#define CALIB_POINTS_NUM     (uint8)2   //reference points of a calibration
+#define CALIB_REF_DIGITS     (uint8)3   //reference temperature in tenths of a degree, 00.0 .. 99.9
+#define CALIB_GAIN_SHIFT     (uint8)14  //the gain is sent in Q2.14
+#define CALIB_DONE           (uint8)0x01
+#define CALIB_NOT_SAVED      (uint8)0x02 //applied on the slave but not stored in its EEPROM
+
+#define TREND_SAMPLES        (uint8)128 //history samples of the trend (10 s each on the slave)
+#define TREND_COLUMNS        (uint8)16  //one bar per LCD column
+#define TREND_BAR_ROWS       (uint8)7   //pixel rows of a bar, custom characters 0..6 hold heights 1..7
+#define STREAM_BYTE_TIME     (uint16)2  //time in (ms) between the bytes of a bulk response
+#define HISTORY_WINDOWS_NUM  (uint8)3   //statistics windows on the slave: 1 min, 5 min, 21 min
+
+/****************************   Live temperature refresh  *****************************************/
+/* One refresh is 5 bytes on the link (request + current and target, high byte first), so the link is
+   busy for 5 bytes every REFRESH_PERIOD_TICKS, the waits between them are spent polling the keypad */
+#define REFRESH_PERIOD_TICKS    (uint8)100 //Timer0 ticks (10 ms) between two refreshes, max 254
+#define REFRESH_RESPONSE_TICKS  (uint8)2   //ticks the slave gets to load every byte of the response
+#define REFRESH_RESPONSE_BYTES  (uint8)4
+#define REFRESH_IDLE            (uint8)0
+#define REFRESH_RESPONSE        (uint8)1
+#define REFRESH_NO_FIELD        (uint8)0   //the shown screen has no live temperature
+
 #define ON_STATUS   0x01
 #define OFF_STATUS  0x00
+
+/* bits of the DEVICES_STATUS response and the SET_SCENE masks */
+#define ROOM1_BIT     (uint8)0x01
+#define ROOM2_BIT     (uint8)0x02
+#define ROOM3_BIT     (uint8)0x04
+#define ROOM4_BIT     (uint8)0x08
+#define TV_BIT        (uint8)0x10
+#define AIR_COND_BIT  (uint8)0x20
 /* Section : Macro Functions Declarations */
 
 
@@ -118,11 +272,43 @@ extern led_t Guest_led;
 extern led_t Block_led;
 extern timer0_t timer;
 extern spi_t spi;
+extern config_record_t Credentials_record;
+extern const config_store_field_t Config_fields[CONFIG_STORE_KEYS_NUM];
 /* Section : Functions Declarations */
 void TMR0_InterruptHandler(void);
-uint8 ComparePass(const uint8* pass1,const uint8* pass2,const uint8 size);
+void Config_Load(void);
+void Legacy_Credentials_Erase(void);
+uint32 Uptime_Seconds(void);
+void Log_Event(const uint8 Event, const uint8 User, const uint8 Device);
+void Session_Start(const uint8 Timeout);
+void Session_Touch(void);
+void Session_Close(void);
+uint16 Session_SecondsLeft(void);
+void Lockout_Start(void);
+uint16 Lockout_Task(void);
+void ShowLockout(void);
+void ShowEventLog(const uint8 LoginMode);
+uint8 NewSalt(void);
+uint8 PinKeyCode(const uint8 Key);
+uint8 GetPin(const uint8 LoginMode, const uint8 Length, uint8 *pin);
+uint8 EditUser(const uint8 Index, const uint8 Role, const uint8 LoginMode);
+void ManageUsers(const uint8 LoginMode);
 uint8 GetKeyPressed(const uint8 u8LoginMode);
 void MenuOption(const uint8 SelectedRoom,const uint8 LoginMode);
+void SetRoomLevel(const uint8 Room,const uint8 LoginMode);
+void SetAirCondSpeed(const uint8 LoginMode);
+void ShowRoomsTemperature(const uint8 LoginMode);
+void DisplayTenths(sint16 value);
+void SetThermostatControl(const uint8 LoginMode);
+uint8 GetTwoDigits(const uint8 LoginMode, uint8 *Prompt, const uint8 Row, uint8 *value);
+uint8 GetNumber(const uint8 LoginMode, uint8 *Prompt, const uint8 Row, const uint8 DigitsNum, uint16 *value);
+void CalibrateRoomSensor(const uint8 LoginMode);
+void SetAirCondProtection(const uint8 LoginMode);
+void ShowTemperatureTrend(const uint8 LoginMode);
+void ShowHistoryStats(const uint8 Window);
+void Refresh_Show(const uint8 Row, const uint8 Column);
+void Refresh_Task(void);
+void Refresh_Flush(void);
 
 #endif	/* MASTER_APP_H */
 
@@ -0,0 +1,187 @@
+/* 
+ * File:   adc_scan.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 6:40 AM
+ */
+
+#include "adc_scan.h"
+
+static const adc_scan_t *scan_config = NULL;
+static uint8 current_index = ZERO_INIT;
+static temp_sensor_decimator_t decimators[ADC_SCAN_CHANNELS_NUM];
+
+/* Written by the ADC interrupt only */
+static volatile uint8 table_sequence = ZERO_INIT;
+static volatile uint16 table_results[ADC_SCAN_CHANNELS_NUM];
+static volatile uint8 table_results_count[ADC_SCAN_CHANNELS_NUM];
+
+/* Written from interrupt context only (tick and ADC) */
+static uint8 window_ticks = ZERO_INIT;
+static uint8 window_conversions[ADC_SCAN_CHANNELS_NUM];
+static volatile uint8 channel_rates[ADC_SCAN_CHANNELS_NUM];
+
+/**
+ * @brief Initializes the sequencer, configures the analog pins and selects the first channel.
+ * 
+ * @param scan A pointer to the scan configuration structure (must stay valid while running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_init(const adc_scan_t *scan)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == scan || NULL == scan->adc)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        scan_config = scan;
+        for(l_index = ZERO_INIT; l_index < ADC_SCAN_CHANNELS_NUM; l_index++)
+        {
+            decimators[l_index].accumulator = ZERO_INIT;
+            decimators[l_index].samples_num = ZERO_INIT;
+            table_results[l_index] = ZERO_INIT;
+            table_results_count[l_index] = ZERO_INIT;
+            window_conversions[l_index] = ZERO_INIT;
+            channel_rates[l_index] = ZERO_INIT;
+        }
+        window_ticks = ZERO_INIT;
+        current_index = ZERO_INIT;
+        ADC_AN_DIG_PORT_CONFIG(scan->analog_pins_cfg);
+        ret = ADC_Select_Channel(scan->adc, scan->channels[current_index]);
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts the conversion of the current channel, called from the periodic tick.
+ *        It also closes the rate measurement window every ADC_SCAN_RATE_WINDOW_TICKS.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_tick(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT;
+
+    if(NULL == scan_config)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if ADC_SCAN_TRIGGER==ADC_SCAN_TRIGGER_SOFTWARE
+        //A conversion still in progress keeps its channel, this tick is skipped
+        if(!ADC_STATUS())
+        {
+            ret = ADC_Start(scan_config->adc);
+        }
+#endif
+        window_ticks++;
+        if(window_ticks >= ADC_SCAN_RATE_WINDOW_TICKS)
+        {
+            window_ticks = ZERO_INIT;
+            for(l_index = ZERO_INIT; l_index < ADC_SCAN_CHANNELS_NUM; l_index++)
+            {
+                channel_rates[l_index] = window_conversions[l_index];
+                window_conversions[l_index] = ZERO_INIT;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Collects the conversion result and moves to the next channel, called from the ADC interrupt.
+ */
+void adc_scan_isr(void)
+{
+    uint16 l_adc_res = ZERO_INIT, l_decimated = ZERO_INIT;
+    uint8 l_status = TEMP_SENSOR_RESULT_NOT_READY;
+
+    if(NULL == scan_config)
+    {
+        return;
+    }
+    ADC_Get_Result(scan_config->adc, &l_adc_res);
+    temp_sensor_oversample(&decimators[current_index], l_adc_res, &l_decimated, &l_status);
+    window_conversions[current_index]++;
+    if(TEMP_SENSOR_RESULT_READY == l_status)
+    {
+        table_sequence++;
+        table_results[current_index] = l_decimated;
+        table_results_count[current_index]++;
+        table_sequence++;
+    }
+    //Switch the multiplexer now, the channel settles until the next tick or trigger starts its conversion
+    current_index++;
+    if(current_index >= ADC_SCAN_CHANNELS_NUM)
+    {
+        current_index = ZERO_INIT;
+    }
+    ADC_Select_Channel(scan_config->adc, scan_config->channels[current_index]);
+}
+
+/**
+ * @brief Copies a consistent snapshot of the result table without blocking the interrupt.
+ * 
+ * @param snapshot A pointer to store the snapshot.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_snapshot(adc_scan_snapshot_t *snapshot)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_sequence = ZERO_INIT, l_index = ZERO_INIT;
+
+    if(NULL == snapshot)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Copy again if the ADC interrupt updated the table during the copy
+        do
+        {
+            l_sequence = table_sequence;
+            for(l_index = ZERO_INIT; l_index < ADC_SCAN_CHANNELS_NUM; l_index++)
+            {
+                snapshot->results[l_index] = table_results[l_index];
+                snapshot->results_count[l_index] = table_results_count[l_index];
+            }
+        }while(l_sequence != table_sequence);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the conversions per second of a channel measured over the last window.
+ * 
+ * @param channel_index The index of the channel in the scan list.
+ * @param rate A pointer to store the rate.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_get_rate(uint8 channel_index, uint8 *rate)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == rate || channel_index >= ADC_SCAN_CHANNELS_NUM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *rate = channel_rates[channel_index];
+    }
+    return ret;
+}
@@ -0,0 +1,93 @@
+/* 
+ * File:   adc_scan.h
+ * Author: Mohamed Sameh
+ * Description:
+ * This header file defines a round-robin ADC sequencer. Every tick converts the current channel of
+ * the list, the ADC interrupt oversamples the result into the channel's decimator and switches the
+ * multiplexer to the next channel, so the input settles during the rest of the tick before its
+ * conversion starts. Decimated results are published in a table that the main code reads with
+ * adc_scan_snapshot() without disabling interrupts: a sequence counter changed by every update
+ * tells the reader to copy again if the interrupt wrote the table while it was being copied.
+ * With ADC_SCAN_TRIGGER_CCP2 the conversions are started by the CCP2 special event trigger (compare
+ * on Timer1) instead of the tick, so the sample period doesn't depend on the interrupt latency. The
+ * application configures Timer1 and CCP2, the sequencer only reacts to the conversion interrupt.
+ * 
+ * Created on October 19, 2026, 6:40 AM
+ */
+
+#ifndef ADC_SCAN_H
+#define	ADC_SCAN_H
+
+/* Section : Includes */
+#include "../../MCAL/ADC/adc.h"
+#include "../Temp_Sensor/temp_sensor.h"
+#include "adc_scan_cfg.h"
+
+/* Section : Macro Declarations */
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    const adc_config_t *adc;                        // The ADC, its interrupt handler must call adc_scan_isr()
+    adc_channel_t channels[ADC_SCAN_CHANNELS_NUM];  // The scan list
+    uint8 analog_pins_cfg;                          // @ref Analog-To-Digital Port Configuration Control
+}adc_scan_t;
+
+typedef struct
+{
+    uint16 results[ADC_SCAN_CHANNELS_NUM];          // Latest decimated result of every channel
+    uint8 results_count[ADC_SCAN_CHANNELS_NUM];     // Decimated results of every channel so far (wraps)
+}adc_scan_snapshot_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Initializes the sequencer, configures the analog pins and selects the first channel.
+ * 
+ * @param scan A pointer to the scan configuration structure (must stay valid while running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_init(const adc_scan_t *scan);
+
+/**
+ * @brief Starts the conversion of the current channel, called from the periodic tick.
+ *        It also closes the rate measurement window every ADC_SCAN_RATE_WINDOW_TICKS.
+ *        With the CCP2 trigger the hardware starts the conversions and only the window is kept.
+ * 
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_tick(void);
+
+/**
+ * @brief Collects the conversion result and moves to the next channel, called from the ADC interrupt.
+ */
+void adc_scan_isr(void);
+
+/**
+ * @brief Copies a consistent snapshot of the result table without blocking the interrupt.
+ * 
+ * @param snapshot A pointer to store the snapshot.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_snapshot(adc_scan_snapshot_t *snapshot);
+
+/**
+ * @brief Reads the conversions per second of a channel measured over the last window.
+ * 
+ * @param channel_index The index of the channel in the scan list.
+ * @param rate A pointer to store the rate.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType adc_scan_get_rate(uint8 channel_index, uint8 *rate);
+
+#endif	/* ADC_SCAN_H */
+
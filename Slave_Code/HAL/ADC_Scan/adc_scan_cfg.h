@@ -0,0 +1,28 @@
+/* 
+ * File:   adc_scan_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 6:40 AM
+ */
+
+#ifndef ADC_SCAN_CFG_H
+#define	ADC_SCAN_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define ADC_SCAN_CHANNELS_NUM           4U      // Number of channels in the scan list
+#define ADC_SCAN_RATE_WINDOW_TICKS      200U    // Ticks of the rate measurement window (1 s at 5 ms), 255 max
+
+#define ADC_SCAN_TRIGGER_SOFTWARE       0x00    // adc_scan_tick() sets GO, the period jitters with the tick latency
+#define ADC_SCAN_TRIGGER_CCP2           0x01    // The CCP2 special event sets GO, adc_scan_tick() only keeps the rate window
+#define ADC_SCAN_TRIGGER                (ADC_SCAN_TRIGGER_CCP2)
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* ADC_SCAN_CFG_H */
+
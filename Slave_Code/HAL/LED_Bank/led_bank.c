@@ -0,0 +1,103 @@
+/* 
+ * File:   led_bank.c
+ * Author: Mohamed Sameh
+ * 
+ * Description:
+ * This source file contains the implementation of the LED bank functions. The bank owns a set of pins
+ * on one port and keeps their state as a bitmap, every update is merged with the rest of the port
+ * and written back with a single store to the LAT register.
+ * 
+ * Created on October 19, 2026, 1:10 AM
+ */
+
+#include "led_bank.h"
+
+/**
+ * @brief Initializes the owned pins of the bank as OUTPUT and writes the initial state bitmap.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_init(led_bank_t *bank)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_direction = ZERO_INIT;
+
+    if(NULL == bank)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        bank->state &= bank->mask;
+        //Write the initial state before the pins are driven
+        ret = led_bank_apply(bank, bank->state, (uint8)~bank->state);
+        //Configure the owned pins as output and keep the direction of the others
+        ret &= gpio_port_get_direction(bank->port, &l_direction);
+        ret &= gpio_port_set_direction(bank->port, (uint8)(l_direction & ~bank->mask));
+    }
+    return ret;
+}
+
+/**
+ * @brief Turns on and off any combination of the bank devices in a single latch store.
+ * 
+ * The latch is read, merged and written back with the interrupts disabled, so an ISR that
+ * updates the same bank can't lose its update in the middle of the read-modify-write.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @param on_mask Bitmap of the devices to turn on.
+ * @param off_mask Bitmap of the devices to turn off.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_apply(led_bank_t *bank, uint8 on_mask, uint8 off_mask)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_latch = ZERO_INIT;
+    //Reads the Interrupt Status "enabled or disabled"
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+
+    if(NULL == bank)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        INTCONbits.GIE = 0;
+        bank->state = (uint8)(((bank->state | on_mask) & ~off_mask) & bank->mask);
+        ret = gpio_port_read(bank->port, &l_latch);
+        //Single store to the latch with the new state of all the bank devices
+        ret &= gpio_port_write(bank->port, (uint8)((l_latch & ~bank->mask) | bank->state));
+        //Restores the Interrupt Status "enabled or disabled"
+        INTCONbits.GIE = Global_Interrupt_Status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the state bitmap of the whole bank.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @param state A pointer to store the state bitmap (bit set = device on).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_read(const led_bank_t *bank, uint8 *state)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == bank || NULL == state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *state = bank->state;
+    }
+    return ret;
+}
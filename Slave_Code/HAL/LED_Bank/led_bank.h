@@ -0,0 +1,72 @@
+/* 
+ * File:   led_bank.h
+ * Author: Mohamed Sameh
+ * Description:
+ * This header file defines the interface for controlling a bank of LEDs/relays that share one port.
+ * The bank keeps the state of its devices as a bitmap mirrored to the data latch, so any combination
+ * of devices can be switched with a single latch store and the whole bank can be read in one access.
+ * 
+ * Created on October 19, 2026, 1:10 AM
+ */
+
+#ifndef LED_BANK_H
+#define	LED_BANK_H
+
+/* Section : Includes */
+#include "../..//MCAL/GPIO/gpio.h"
+
+/* Section : Macro Declarations */
+#define LED_BANK_NO_CHANGE     (uint8)0x00
+
+/* Section : Macro Functions Declarations */
+//Bit mask of a device inside the bank
+#define LED_BANK_BIT(_PIN)     (uint8)(BIT_MASK << (_PIN))
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    uint8 port : 3;     // @ref port_index_t
+    uint8 reserved : 5;
+    uint8 mask;         // Pins of the port owned by the bank
+    uint8 state;        // Bitmap of the devices state (mirror of the owned latch bits)
+}led_bank_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Initializes the owned pins of the bank as OUTPUT and writes the initial state bitmap.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_init(led_bank_t *bank);
+
+/**
+ * @brief Turns on and off any combination of the bank devices in a single latch store.
+ * 
+ * Bits set in on_mask are turned on, then bits set in off_mask are turned off,
+ * bits outside the bank mask are ignored and the rest of the port is left untouched.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @param on_mask Bitmap of the devices to turn on.
+ * @param off_mask Bitmap of the devices to turn off.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_apply(led_bank_t *bank, uint8 on_mask, uint8 off_mask);
+
+/**
+ * @brief Reads the state bitmap of the whole bank.
+ * 
+ * @param bank A pointer to the LED bank configuration structure.
+ * @param state A pointer to store the state bitmap (bit set = device on).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType led_bank_read(const led_bank_t *bank, uint8 *state);
+
+#endif	/* LED_BANK_H */
+
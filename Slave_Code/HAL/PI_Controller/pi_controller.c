@@ -0,0 +1,148 @@
+/* 
+ * File:   pi_controller.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:10 AM
+ */
+
+#include "pi_controller.h"
+
+//Tenths per degree times steps per minute, the integral gain is per degree per minute
+#define PI_CONTROLLER_KI_DIVISOR    (10UL * (60000UL / PI_CONTROLLER_STEP_MS))
+
+/**
+ * @brief Sets the gains of the controller and clears its integral term.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param kp The proportional gain in percent of output per degree of error.
+ * @param ki The integral gain in percent of output per degree of error per minute.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_init(pi_controller_t *ctrl, uint8 kp, uint8 ki)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = pi_controller_set_gains(ctrl, kp, ki);
+    ret &= pi_controller_reset(ctrl);
+    return ret;
+}
+
+/**
+ * @brief Sets the gains of the controller, the integral term is kept.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param kp The proportional gain in percent of output per degree of error.
+ * @param ki The integral gain in percent of output per degree of error per minute.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_set_gains(pi_controller_t *ctrl, uint8 kp, uint8 ki)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == ctrl)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ctrl->kp = kp;
+        ctrl->ki = ki;
+        //The divisions are done once here, not on every step
+        ctrl->kp_q8 = (uint16)((((uint32)kp << 8) + 5UL) / 10UL);
+        ctrl->ki_q16 = (uint16)((((uint32)ki << 16) + (PI_CONTROLLER_KI_DIVISOR / 2)) / PI_CONTROLLER_KI_DIVISOR);
+    }
+    return ret;
+}
+
+/**
+ * @brief Clears the integral term, used when the loop is (re)started.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_reset(pi_controller_t *ctrl)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == ctrl)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ctrl->integral_q16 = ZERO_INIT;
+    }
+    return ret;
+}
+
+/**
+ * @brief Runs one control step, must be called every PI_CONTROLLER_STEP_MS.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param error The control error in tenths of a degree (positive drives the output up).
+ * @param output A pointer to store the output in percent.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_update(pi_controller_t *ctrl, sint16 error, uint8 *output)
+{
+    Std_ReturnType ret = E_OK;
+    sint32 l_proportional = ZERO_INIT, l_integral = ZERO_INIT, l_sum = ZERO_INIT;
+
+    if(NULL == ctrl || NULL == output)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(error > PI_CONTROLLER_ERROR_LIMIT)
+        {
+            error = PI_CONTROLLER_ERROR_LIMIT;
+        }
+        else if(error < -PI_CONTROLLER_ERROR_LIMIT)
+        {
+            error = -PI_CONTROLLER_ERROR_LIMIT;
+        }else{/* Nothing */}
+
+        //6528 * 1000 * 256 still fits in 31 bits
+        l_proportional = (sint32)ctrl->kp_q8 * error * 256;
+        l_integral = ctrl->integral_q16 + ((sint32)ctrl->ki_q16 * error);
+        if(l_integral > PI_CONTROLLER_OUTPUT_MAX_Q16)
+        {
+            l_integral = PI_CONTROLLER_OUTPUT_MAX_Q16;
+        }
+        else if(l_integral < 0)
+        {
+            l_integral = 0;
+        }else{/* Nothing */}
+
+        l_sum = l_proportional + l_integral;
+        if(l_sum > PI_CONTROLLER_OUTPUT_MAX_Q16)
+        {
+            l_sum = PI_CONTROLLER_OUTPUT_MAX_Q16;
+            if(error > 0)
+            {
+                l_integral = ctrl->integral_q16;//saturated high, don't wind up
+            }
+        }
+        else if(l_sum < 0)
+        {
+            l_sum = 0;
+            if(error < 0)
+            {
+                l_integral = ctrl->integral_q16;//saturated low, don't wind down
+            }
+        }else{/* Nothing */}
+
+        ctrl->integral_q16 = l_integral;
+        *output = (uint8)((l_sum + 0x8000L) >> 16);
+    }
+    return ret;
+}
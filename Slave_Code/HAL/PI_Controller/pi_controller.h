@@ -0,0 +1,89 @@
+/* 
+ * File:   pi_controller.h
+ * Author: Mohamed Sameh
+ * Description:
+ * This header file defines an integer PI controller for slow loops like a room thermostat.
+ * The error is in tenths of a degree and the output in percent (0 .. PI_CONTROLLER_OUTPUT_MAX).
+ * The gains are given in user units and converted once to fixed point: the proportional gain to
+ * Q8 percent per tenth and the integral gain to Q16 percent per tenth per step, so an update is
+ * two 16x16 multiplications and no division.
+ * 
+ * Anti-windup: the integral is clamped to the output range and it isn't integrated further while
+ * the output is saturated in the direction of the error (conditional integration).
+ * 
+ * thermostat_sim.py runs this controller on a host model of a room and compares the modes of the
+ * slave thermostat with the hysteresis loop (tracking error and compressor switches).
+ * 
+ * Created on October 19, 2026, 9:10 AM
+ */
+
+#ifndef PI_CONTROLLER_H
+#define	PI_CONTROLLER_H
+
+/* Section : Includes */
+#include "../../MCAL/std_types.h"
+#include "pi_controller_cfg.h"
+
+/* Section : Macro Declarations */
+#define PI_CONTROLLER_OUTPUT_MAX_Q16    ((sint32)PI_CONTROLLER_OUTPUT_MAX << 16)
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    uint16 kp_q8;           // Percent per tenth of a degree in Q8 (255 %/C = 6528)
+    uint16 ki_q16;          // Percent per tenth per step in Q16 (255 %/C.min at 1 s = 27852)
+    sint32 integral_q16;    // Integral term in Q16 percent (0 .. PI_CONTROLLER_OUTPUT_MAX_Q16)
+    uint8 kp;               // Proportional gain as set, percent per degree
+    uint8 ki;               // Integral gain as set, percent per degree per minute
+}pi_controller_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Sets the gains of the controller and clears its integral term.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param kp The proportional gain in percent of output per degree of error.
+ * @param ki The integral gain in percent of output per degree of error per minute.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_init(pi_controller_t *ctrl, uint8 kp, uint8 ki);
+
+/**
+ * @brief Sets the gains of the controller, the integral term is kept.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param kp The proportional gain in percent of output per degree of error.
+ * @param ki The integral gain in percent of output per degree of error per minute.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_set_gains(pi_controller_t *ctrl, uint8 kp, uint8 ki);
+
+/**
+ * @brief Clears the integral term, used when the loop is (re)started.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_reset(pi_controller_t *ctrl);
+
+/**
+ * @brief Runs one control step, must be called every PI_CONTROLLER_STEP_MS.
+ * 
+ * @param ctrl A pointer to the controller.
+ * @param error The control error in tenths of a degree (positive drives the output up).
+ * @param output A pointer to store the output in percent.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType pi_controller_update(pi_controller_t *ctrl, sint16 error, uint8 *output);
+
+#endif	/* PI_CONTROLLER_H */
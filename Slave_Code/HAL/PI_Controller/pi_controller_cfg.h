@@ -0,0 +1,24 @@
+/* 
+ * File:   pi_controller_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:10 AM
+ */
+
+#ifndef PI_CONTROLLER_CFG_H
+#define	PI_CONTROLLER_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define PI_CONTROLLER_STEP_MS           1000UL  // Time between two calls of pi_controller_update
+#define PI_CONTROLLER_OUTPUT_MAX        100     // Output range is 0 .. max (percent)
+#define PI_CONTROLLER_ERROR_LIMIT       1000    // Error is clamped to +/- limit (tenths of a degree)
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* PI_CONTROLLER_CFG_H */
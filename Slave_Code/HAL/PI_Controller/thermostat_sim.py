@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+#
+# File:   thermostat_sim.py
+# Author: Mohamed Sameh
+#
+# Host simulation of the slave thermostat on a thermal model of a room, it compares the hysteresis
+# loop with the PI controller in the window and PWM modes by the tracking error and the number of
+# compressor switches (starts + stops, what GET_AC_PROTECT reports).
+#
+# The PI steps are done by pi_controller.c itself, built with the host C compiler and driven over a
+# pipe. The control step of Slave_App.c (Thermostat_Task, Thermostat_Hysteresis, Thermostat_Window
+# and the minimum on/off times of Air_Cond_Duty) is ported below and its constants are read from
+# Slave_App.h, so keep the two in step when the control changes.
+#
+# Room model, one step per control step (1 s):
+#   - the air exchanges heat with the wall mass (600 s) and the outside at 33 C (1200 s),
+#   - the mass follows the air (1800 s),
+#   - the cooling follows the compressor command with a 90 s coil lag, full cooling holds the room
+#     at 15 C, so the room needs about 50 % at 24 C,
+#   - the reading is the air temperature plus 0.05 C rms noise, rounded to tenths.
+# The room starts at 28 C, the first hour is discarded, the next 5 are measured.
+#     python3 thermostat_sim.py
+#
+# Created on October 19, 2026, 11:55 PM
+
+import argparse
+import math
+import os
+import random
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SLAVE_APP_H = os.path.join(HERE, "..", "..", "Slave_App.h")
+
+OUTSIDE_C = 33.0
+START_C = 28.0
+AIR_TO_MASS_S = 600.0
+AIR_TO_OUTSIDE_S = 1200.0
+MASS_TO_AIR_S = 1800.0
+COIL_LAG_S = 90.0
+FULL_COOLING = (OUTSIDE_C - 15.0) / AIR_TO_OUTSIDE_S    # C/s on the air at 100 %
+NOISE_C = 0.05
+SEED = 1
+SETTLE_S = 3600
+RUN_S = 6 * 3600
+
+# Reads one error per line, prints the output of the step
+DRIVER = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include "pi_controller.h"
+
+int main(int argc, char *argv[])
+{
+    pi_controller_t ctrl;
+    int error;
+    uint8 output;
+
+    if(3 != argc)
+    {
+        return 1;
+    }
+    pi_controller_init(&ctrl, (uint8)atoi(argv[1]), (uint8)atoi(argv[2]));
+    while(1 == scanf("%d", &error))
+    {
+        pi_controller_update(&ctrl, (sint16)error, &output);
+        printf("%u\n", output);
+        fflush(stdout);
+    }
+    return 0;
+}
+"""
+
+
+def slave_constants():
+    with open(SLAVE_APP_H) as header:
+        text = header.read()
+    return {name: int(value) for name, value in
+            re.findall(r"#define\s+(\w+)\s+\((?:uint8|uint16|sint16)\)(\d+)", text)}
+
+
+def build_driver(work):
+    # pi_controller.c only needs the types of <xc.h>, no register
+    open(os.path.join(work, "xc.h"), "w").close()
+    driver = os.path.join(work, "driver.c")
+    with open(driver, "w") as source:
+        source.write(DRIVER)
+    binary = os.path.join(work, "driver")
+    subprocess.run([os.environ.get("CC", "cc"), "-std=c99", "-Wall", "-I", work, "-I", HERE,
+                    "-o", binary, driver, os.path.join(HERE, "pi_controller.c")], check=True)
+    return binary
+
+
+class Compressor:
+    """Air_Cond_Duty() and Air_Cond_Stop() with the minimum on/off times"""
+
+    def __init__(self, const):
+        self.min_on = const["AC_MIN_ON_DEFAULT"] * const["AC_SECONDS_PER_MINUTE"]
+        self.min_off = const["AC_MIN_OFF_DEFAULT"] * const["AC_SECONDS_PER_MINUTE"]
+        self.running = False
+        self.lockout = 0
+        self.duty = 0
+        self.switches = 0
+
+    def step(self):
+        if self.lockout > 0:
+            self.lockout -= 1
+
+    def set_duty(self, duty):
+        if duty != 0 and not self.running:
+            if self.lockout > 0:
+                return
+            self.running = True
+            self.lockout = self.min_on
+            self.switches += 1
+        elif duty == 0 and self.running:
+            if self.lockout > 0:
+                return
+            self.running = False
+            self.lockout = self.min_off
+            self.switches += 1
+            self.duty = 0
+            return
+        self.duty = duty
+
+
+def run(mode, const, binary, kp, ki, speed=100):
+    rng = random.Random(SEED)
+    setpoint = const["SETPOINT_DEFAULT"]
+    deadband = const["THERMOSTAT_DEADBAND_DEFAULT"]
+    window = const["THERMOSTAT_WINDOW_STEPS"]
+    min_pulse = const["THERMOSTAT_MIN_PULSE_STEPS"]
+    ac = Compressor(const)
+    last_on = False
+    window_step = 0
+    window_on_steps = 0
+    air = mass = START_C
+    coil = 0.0
+    square_sum = 0.0
+    samples = 0
+    pi = None
+    if mode != "hysteresis":
+        pi = subprocess.Popen([binary, str(kp), str(ki)], stdin=subprocess.PIPE,
+                              stdout=subprocess.PIPE, text=True, bufsize=1)
+
+    for second in range(RUN_S):
+        reading = int(round((air + rng.gauss(0.0, NOISE_C)) * 10))
+        ac.step()
+        if mode == "hysteresis":
+            if reading >= setpoint + deadband:
+                last_on = True
+            elif reading <= setpoint - deadband:
+                last_on = False
+            ac.set_duty(speed if last_on else 0)
+        else:
+            pi.stdin.write("%d\n" % (reading - setpoint))
+            output = int(pi.stdout.readline())
+            if mode == "pwm":
+                ac.set_duty(output * speed // 100)
+            else:
+                on_steps = output * window // 100
+                if on_steps < min_pulse:
+                    on_steps = 0
+                elif on_steps > window - min_pulse:
+                    on_steps = window
+                if window_step == 0:
+                    window_on_steps = on_steps
+                elif window_step < window_on_steps:
+                    window_on_steps = max(on_steps, window_step)
+                ac.set_duty(speed if window_step < window_on_steps else 0)
+                window_step = (window_step + 1) % window
+
+        coil += (ac.duty / 100.0 - coil) / COIL_LAG_S
+        air += ((mass - air) / AIR_TO_MASS_S + (OUTSIDE_C - air) / AIR_TO_OUTSIDE_S
+                - coil * FULL_COOLING)
+        mass += (air - mass) / MASS_TO_AIR_S
+        if second >= SETTLE_S:
+            square_sum += (air - setpoint / 10.0) ** 2
+            samples += 1
+        if second == SETTLE_S:
+            switches_at_settle = ac.switches
+
+    if pi is not None:
+        pi.stdin.close()
+        pi.wait()
+    return math.sqrt(square_sum / samples), ac.switches - switches_at_settle
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--gains", default="", help="extra kp:ki pairs, comma separated")
+    args = parser.parse_args()
+    const = slave_constants()
+    gains = [(const["THERMOSTAT_KP_DEFAULT"], const["THERMOSTAT_KI_DEFAULT"]), (10, 2), (40, 10)]
+    gains += [tuple(int(v) for v in pair.split(":")) for pair in args.gains.split(",") if pair]
+
+    work = tempfile.mkdtemp()
+    try:
+        binary = build_driver(work)
+        hours = (RUN_S - SETTLE_S) / 3600.0
+        print("setpoint %.1f C, deadband %.1f C, window %d s (pulses >= %d s), min on %d s, min off %d s"
+              % (const["SETPOINT_DEFAULT"] / 10.0, const["THERMOSTAT_DEADBAND_DEFAULT"] / 10.0,
+                 const["THERMOSTAT_WINDOW_STEPS"], const["THERMOSTAT_MIN_PULSE_STEPS"],
+                 const["AC_MIN_ON_DEFAULT"] * 60, const["AC_MIN_OFF_DEFAULT"] * 60))
+        print("over %.0f h after the first hour:" % hours)
+        error, switches = run("hysteresis", const, binary, 0, 0)
+        print("  %-22s rms %.2f C, %3d switches" % ("hysteresis", error, switches))
+        for kp, ki in gains:
+            for mode in ("window", "pwm"):
+                error, switches = run(mode, const, binary, kp, ki)
+                print("  %-22s rms %.2f C, %3d switches" % ("PI %s kp%d ki%d" % (mode, kp, ki), error, switches))
+    finally:
+        shutil.rmtree(work)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
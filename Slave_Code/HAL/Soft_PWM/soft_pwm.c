@@ -0,0 +1,295 @@
+/*
+ * File:   soft_pwm.c
+ * Author: Mohamed Sameh
+ *
+ * Description:
+ * This source file contains the implementation of the software PWM engine.
+ * The main code builds a sorted edge table in a shadow buffer, the Timer3 handler swaps it in at
+ * the start of the next period, so the handler never waits for the main code and never sorts.
+ *
+ * Created on October 19, 2026, 2:20 AM
+ */
+
+#include "soft_pwm.h"
+
+#define SOFT_PWM_PERIOD_START   (uint8)0xFF     /* Next event is the start of a period */
+#define SOFT_PWM_NO_UPDATE      (uint8)0
+#define SOFT_PWM_UPDATE_PENDING (uint8)1
+//Minimum counts between the reload and the next interrupt when the handler is late.
+#define SOFT_PWM_LATE_GUARD     (uint16)64
+//Edges from this level up are too close to the end of the period, they merge into its start (always on).
+#define SOFT_PWM_LAST_EDGE_LEVEL (uint8)(256U - SOFT_PWM_MIN_GAP_LEVELS)
+
+typedef struct
+{
+    uint8 level;        // Level at which the channels go off
+    uint8 off_mask;     // Bank bits to turn off at this level
+}soft_pwm_edge_t;
+
+typedef struct
+{
+    soft_pwm_edge_t edges[SOFT_PWM_CHANNELS_NUM];   // Sorted by level, one entry per distinct level
+    uint8 edges_num;
+    uint8 on_mask;                                  // Channels on at the period start (level > 0)
+}soft_pwm_table_t;
+
+static void soft_pwm_timer_handler(void);
+static void soft_pwm_build_table(void);
+
+static const soft_pwm_t *pwm_config = NULL;
+static uint8 channels_mask = ZERO_INIT;
+static uint8 channel_levels[SOFT_PWM_CHANNELS_NUM];
+
+static soft_pwm_table_t tables[2];
+static volatile uint8 active_table = ZERO_INIT;
+static volatile uint8 update_pending = SOFT_PWM_NO_UPDATE;
+static uint8 next_edge = SOFT_PWM_PERIOD_START;
+
+static uint16 isr_cycles_acc = ZERO_INIT;
+static volatile uint16 isr_cycles_last = ZERO_INIT;
+static volatile uint16 isr_cycles_max = ZERO_INIT;
+
+/* Preload is 0 so TMR3_ISR doesn't write it, the timer value in the handler is the time elapsed since the overflow */
+static timer3_t pwm_timer =
+{
+    .TMR3_InterruptHandler = soft_pwm_timer_handler,
+    .timer3_preload = 0,
+    .timer3_prescaler_value = TIMER3_PRESCALER_DIV_1,
+    .timer3_mode = TIMER3_TIMER_MODE,
+    .timer3_reg_wr_mode = TIMER3_RW_REG_16BIT_MODE,
+};
+
+/**
+ * @brief Initializes the engine with all channels off and starts Timer3.
+ *
+ * @param pwm A pointer to the soft PWM configuration structure (must stay valid while running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_init(const soft_pwm_t *pwm)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_channel = ZERO_INIT;
+
+    if(NULL == pwm || NULL == pwm->bank)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        pwm_config = pwm;
+        channels_mask = ZERO_INIT;
+        for(l_channel = ZERO_INIT; l_channel < SOFT_PWM_CHANNELS_NUM; l_channel++)
+        {
+            channel_levels[l_channel] = SOFT_PWM_LEVEL_OFF;
+            channels_mask |= pwm->channel_mask[l_channel];
+        }
+        //The timer is not running yet, so the built table can be activated directly
+        soft_pwm_build_table();
+        active_table ^= 1;
+        update_pending = SOFT_PWM_NO_UPDATE;
+        next_edge = SOFT_PWM_PERIOD_START;
+        ret = led_bank_apply(pwm->bank, LED_BANK_NO_CHANGE, channels_mask);
+        ret &= Timer3_Init(&pwm_timer);
+    }
+    return ret;
+}
+
+/**
+ * @brief Sets the brightness level of a channel, it takes effect at the start of the next period.
+ *
+ * @param channel The channel index (0 .. SOFT_PWM_CHANNELS_NUM-1).
+ * @param level The brightness level (0: off, 255: fully on).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_set_level(uint8 channel, uint8 level)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == pwm_config || channel >= SOFT_PWM_CHANNELS_NUM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        channel_levels[channel] = level;
+        soft_pwm_build_table();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the brightness level of a channel.
+ *
+ * @param channel The channel index (0 .. SOFT_PWM_CHANNELS_NUM-1).
+ * @param level A pointer to store the level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_get_level(uint8 channel, uint8 *level)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == level || channel >= SOFT_PWM_CHANNELS_NUM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *level = channel_levels[channel];
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the measured interrupt cost of the engine.
+ *
+ * @param last_period_cycles A pointer to store the cost of the last complete period.
+ * @param max_period_cycles A pointer to store the maximum cost of a period since init.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_get_isr_load(uint16 *last_period_cycles, uint16 *max_period_cycles)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == last_period_cycles || NULL == max_period_cycles)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The 16-bit values are updated by the handler, read them with its interrupt masked
+        TIMER3_INTERRUPT_DISABLE();
+        *last_period_cycles = isr_cycles_last;
+        *max_period_cycles = isr_cycles_max;
+        TIMER3_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Builds the sorted edge table of the current levels in the shadow buffer.
+ *
+ * The pending flag is cleared first so the handler can't swap the shadow buffer while it's
+ * being written, then it's set again to hand the new table over at the next period start.
+ */
+static void soft_pwm_build_table(void)
+{
+    soft_pwm_table_t *l_table = NULL;
+    uint8 l_channel = ZERO_INIT, l_index = ZERO_INIT, l_shift = ZERO_INIT;
+    uint8 l_level = ZERO_INIT, l_mask = ZERO_INIT;
+
+    update_pending = SOFT_PWM_NO_UPDATE;
+    l_table = &tables[active_table ^ 1];
+    l_table->edges_num = ZERO_INIT;
+    l_table->on_mask = ZERO_INIT;
+
+    for(l_channel = ZERO_INIT; l_channel < SOFT_PWM_CHANNELS_NUM; l_channel++)
+    {
+        l_level = channel_levels[l_channel];
+        l_mask = pwm_config->channel_mask[l_channel];
+        if(SOFT_PWM_LEVEL_OFF == l_level)
+        {
+            continue;
+        }
+        l_table->on_mask |= l_mask;
+        if(l_level >= SOFT_PWM_LAST_EDGE_LEVEL)
+        {
+            continue;//always on, no switch-off edge (an edge this late would fire right before the period start)
+        }
+        //Insertion sort, channels with the same level share one edge
+        for(l_index = ZERO_INIT; (l_index < l_table->edges_num) && (l_table->edges[l_index].level < l_level); l_index++);
+        if((l_index < l_table->edges_num) && (l_table->edges[l_index].level == l_level))
+        {
+            l_table->edges[l_index].off_mask |= l_mask;
+        }
+        else
+        {
+            for(l_shift = l_table->edges_num; l_shift > l_index; l_shift--)
+            {
+                l_table->edges[l_shift] = l_table->edges[l_shift - 1];
+            }
+            l_table->edges[l_index].level = l_level;
+            l_table->edges[l_index].off_mask = l_mask;
+            l_table->edges_num++;
+        }
+    }
+    update_pending = SOFT_PWM_UPDATE_PENDING;
+}
+
+/**
+ * @brief Timer3 callback, serves the period start or the next switch-off edge and reloads
+ *        Timer3 to fire at the following event.
+ */
+static void soft_pwm_timer_handler(void)
+{
+    const soft_pwm_table_t *l_table = NULL;
+    uint16 l_before = ZERO_INIT, l_now = ZERO_INIT, l_reload = ZERO_INIT, l_delta = ZERO_INIT;
+    uint8 l_level = ZERO_INIT, l_on = LED_BANK_NO_CHANGE, l_off = LED_BANK_NO_CHANGE;
+
+    if(SOFT_PWM_PERIOD_START == next_edge)
+    {
+        if(SOFT_PWM_UPDATE_PENDING == update_pending)
+        {
+            active_table ^= 1;
+            update_pending = SOFT_PWM_NO_UPDATE;
+        }
+        l_table = &tables[active_table];
+        l_on = l_table->on_mask;
+        l_off = (uint8)(channels_mask & ~l_table->on_mask);
+        next_edge = ZERO_INIT;
+        //Publish the cost of the period that just ended
+        isr_cycles_last = isr_cycles_acc;
+        if(isr_cycles_acc > isr_cycles_max)
+        {
+            isr_cycles_max = isr_cycles_acc;
+        }
+        isr_cycles_acc = ZERO_INIT;
+    }
+    else
+    {
+        l_table = &tables[active_table];
+        l_level = l_table->edges[next_edge].level;
+    }
+    //Serve the edges that are too close to have an interrupt of their own
+    while((next_edge < l_table->edges_num) &&
+          ((uint8)(l_table->edges[next_edge].level - l_level) < SOFT_PWM_MIN_GAP_LEVELS))
+    {
+        l_off |= l_table->edges[next_edge].off_mask;
+        next_edge++;
+    }
+    if(next_edge < l_table->edges_num)
+    {
+        l_delta = (uint16)(l_table->edges[next_edge].level - l_level) * SOFT_PWM_COUNTS_PER_LEVEL;
+    }
+    else
+    {
+        l_delta = (uint16)(256U - l_level) * SOFT_PWM_COUNTS_PER_LEVEL;
+        next_edge = SOFT_PWM_PERIOD_START;
+    }
+
+    led_bank_apply(pwm_config->bank, l_on, l_off);
+
+    //Reload so the next overflow happens l_delta counts after this one, the counts elapsed since
+    //the overflow (entry, dispatch and the handler up to here) are kept in the schedule
+    Timer3_Read(&pwm_timer, &l_before);
+    if(l_delta > (uint16)(l_before + SOFT_PWM_LATE_GUARD))
+    {
+        l_reload = (uint16)(l_before - l_delta);
+    }
+    else
+    {
+        //The handler is late (delayed by another interrupt), fire as soon as possible
+        l_reload = (uint16)(0U - SOFT_PWM_LATE_GUARD);
+    }
+    Timer3_Write_Value(&pwm_timer, l_reload);
+    //Handler cost = counts from the overflow to the reload + counts since the reload
+    Timer3_Read(&pwm_timer, &l_now);
+    isr_cycles_acc += (uint16)(l_before + (uint16)(l_now - l_reload));
+}
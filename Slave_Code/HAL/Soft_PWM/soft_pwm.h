@@ -0,0 +1,89 @@
+/* 
+ * File:   soft_pwm.h
+ * Author: Mohamed Sameh
+ * Description:
+ * Multi-channel software PWM engine driven by the Timer3 interrupt.
+ * The duty cycles are kept as a sorted list of switch-off edges, every period starts by turning on
+ * all the active channels and the timer is then reloaded to fire only at the next edge, so the
+ * interrupt count per period depends on the number of distinct levels and not on the channels number.
+ * 
+ * Created on October 19, 2026, 2:20 AM
+ */
+
+#ifndef SOFT_PWM_H
+#define	SOFT_PWM_H
+
+/* -------------- Includes -------------- */
+#include "soft_pwm_cfg.h"
+#include "../LED_Bank/led_bank.h"
+#include "../../MCAL/TIMER3/timer3.h"
+
+/* -------------- Macro Declarations ------------- */
+#define SOFT_PWM_LEVEL_OFF      (uint8)0
+#define SOFT_PWM_LEVEL_MAX      (uint8)255    /* Always on, no switch-off edge */
+
+//Timer3 counts of one full PWM period.
+#define SOFT_PWM_PERIOD_COUNTS  (uint16)(256U * SOFT_PWM_COUNTS_PER_LEVEL)
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+typedef struct
+{
+    led_bank_t *bank;                               // Bank that holds the channels pins
+    uint8 channel_mask[SOFT_PWM_CHANNELS_NUM];      // Bank bit of every channel
+}soft_pwm_t;
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the engine with all channels off and starts Timer3.
+ * 
+ * @param pwm A pointer to the soft PWM configuration structure (must stay valid while running).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_init(const soft_pwm_t *pwm);
+
+/**
+ * @brief Sets the brightness level of a channel, it takes effect at the start of the next period.
+ * 
+ * @note  Levels that end closer than SOFT_PWM_MIN_GAP_LEVELS to the start or to another edge
+ *        are served by the same interrupt, levels within SOFT_PWM_MIN_GAP_LEVELS of the end are
+ *        always on, so the duty error is at most SOFT_PWM_MIN_GAP_LEVELS/256.
+ * @param channel The channel index (0 .. SOFT_PWM_CHANNELS_NUM-1).
+ * @param level The brightness level (0: off, 255: fully on).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_set_level(uint8 channel, uint8 level);
+
+/**
+ * @brief Reads the brightness level of a channel.
+ * 
+ * @param channel The channel index (0 .. SOFT_PWM_CHANNELS_NUM-1).
+ * @param level A pointer to store the level.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_get_level(uint8 channel, uint8 *level);
+
+/**
+ * @brief Reads the measured interrupt cost of the engine.
+ * 
+ * The cost is the sum of the handler execution time of all the interrupts of one period in
+ * instruction cycles (compare with SOFT_PWM_PERIOD_COUNTS for the CPU load), the interrupt entry
+ * and dispatch included: Timer3 keeps counting from its overflow until the handler reloads it.
+ * 
+ * @param last_period_cycles A pointer to store the cost of the last complete period.
+ * @param max_period_cycles A pointer to store the maximum cost of a period since init.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType soft_pwm_get_isr_load(uint16 *last_period_cycles, uint16 *max_period_cycles);
+
+#endif	/* SOFT_PWM_H */
+
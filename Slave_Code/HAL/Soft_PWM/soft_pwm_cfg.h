@@ -0,0 +1,36 @@
+/* 
+ * File:   soft_pwm_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 2:20 AM
+ */
+
+#ifndef SOFT_PWM_CFG_H
+#define	SOFT_PWM_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+//Number of dimmable channels driven by the engine.
+#define SOFT_PWM_CHANNELS_NUM          4
+
+/*
+ * Timer3 counts instruction cycles (Fosc/4, prescaler 1:1), 0.5 us at 8 MHz.
+ * 256 levels * 78 counts = 19968 counts = 9.98 ms period (~100 Hz, no visible flicker).
+ */
+#define SOFT_PWM_COUNTS_PER_LEVEL      (uint16)78
+
+/*
+ * Edges closer than this number of levels are served by the same interrupt,
+ * it must stay above the worst case handler time (4 levels = 312 cycles).
+ */
+#define SOFT_PWM_MIN_GAP_LEVELS        (uint8)4
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+#endif	/* SOFT_PWM_CFG_H */
+
@@ -0,0 +1,282 @@
+/* 
+ * File:   temp_history.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 11:30 AM
+ */
+
+#include "temp_history.h"
+
+#define TEMP_HISTORY_DEQUE_MIN      (uint8)0
+#define TEMP_HISTORY_DEQUE_MAX      (uint8)1
+
+static void temp_history_deque_push(temp_history_entry_t *entries, uint8 size, uint8 *head, uint8 *count,
+                                    uint8 sequence, sint16 value, uint8 deque_type);
+
+static const uint8 window_sizes[TEMP_HISTORY_WINDOWS_NUM] = TEMP_HISTORY_WINDOW_SIZES;
+static uint8 window_offsets[TEMP_HISTORY_WINDOWS_NUM];  // First entry of every window in the pools
+
+/**
+ * @brief Empties the history.
+ * 
+ * @param history A pointer to the history.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_init(temp_history_t *history)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_window = ZERO_INIT, l_offset = ZERO_INIT;
+
+    if(NULL == history)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        history->count = ZERO_INIT;
+        history->oldest_slot = ZERO_INIT;
+        history->sequence = ZERO_INIT;
+        for(l_window = ZERO_INIT; l_window < TEMP_HISTORY_WINDOWS_NUM; l_window++)
+        {
+            window_offsets[l_window] = l_offset;
+            l_offset += window_sizes[l_window];
+            history->windows[l_window].sum = ZERO_INIT;
+            history->windows[l_window].min_head = ZERO_INIT;
+            history->windows[l_window].min_count = ZERO_INIT;
+            history->windows[l_window].max_head = ZERO_INIT;
+            history->windows[l_window].max_count = ZERO_INIT;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Adds a sample, the oldest one is dropped when the history is full.
+ * 
+ * @param history A pointer to the history.
+ * @param value The temperature in tenths of a degree.
+ * @param timestamp The time of the sample in seconds.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_push(temp_history_t *history, sint16 value, uint32 timestamp)
+{
+    Std_ReturnType ret = E_OK;
+    temp_history_window_t *l_window = NULL;
+    sint16 l_delta = ZERO_INIT;
+    uint8 l_index = ZERO_INIT, l_slot = ZERO_INIT, l_previous_count = ZERO_INIT;
+
+    if(NULL == history)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_previous_count = history->count;
+        if(ZERO_INIT == l_previous_count)
+        {
+            history->oldest_value = value;
+            history->newest_value = value;
+            history->oldest_slot = ZERO_INIT;
+            history->deltas[ZERO_INIT] = ZERO_INIT;
+            history->count = 1;
+            for(l_index = ZERO_INIT; l_index < TEMP_HISTORY_WINDOWS_NUM; l_index++)
+            {
+                history->windows[l_index].trailing_value = value;
+                history->windows[l_index].trailing_slot = ZERO_INIT;
+            }
+        }
+        else
+        {
+            //The stored value follows the clamped deltas so the decoded history matches the statistics
+            l_delta = value - history->newest_value;
+            if(l_delta > TEMP_HISTORY_DELTA_MAX)
+            {
+                l_delta = TEMP_HISTORY_DELTA_MAX;
+            }
+            else if(l_delta < TEMP_HISTORY_DELTA_MIN)
+            {
+                l_delta = TEMP_HISTORY_DELTA_MIN;
+            }else{/* Nothing */}
+            history->newest_value += l_delta;
+            l_slot = (uint8)((history->oldest_slot + l_previous_count) % TEMP_HISTORY_SIZE);
+            if(TEMP_HISTORY_SIZE == l_previous_count)
+            {
+                //Full, the new sample takes the slot of the oldest one, whose delta isn't used
+                history->oldest_slot = (uint8)((history->oldest_slot + 1) % TEMP_HISTORY_SIZE);
+                history->oldest_value += history->deltas[history->oldest_slot];
+            }
+            else
+            {
+                history->count++;
+            }
+            history->deltas[l_slot] = (sint8)l_delta;
+            history->sequence++;
+        }
+        history->newest_timestamp = timestamp;
+
+        for(l_index = ZERO_INIT; l_index < TEMP_HISTORY_WINDOWS_NUM; l_index++)
+        {
+            l_window = &history->windows[l_index];
+            l_window->sum += history->newest_value;
+            if(l_previous_count >= window_sizes[l_index])
+            {
+                //The oldest sample leaves the window, the cursor moves to the next one
+                l_window->sum -= l_window->trailing_value;
+                l_window->trailing_slot = (uint8)((l_window->trailing_slot + 1) % TEMP_HISTORY_SIZE);
+                l_window->trailing_value += history->deltas[l_window->trailing_slot];
+            }
+            temp_history_deque_push(&history->min_entries[window_offsets[l_index]], window_sizes[l_index],
+                                    &l_window->min_head, &l_window->min_count,
+                                    history->sequence, history->newest_value, TEMP_HISTORY_DEQUE_MIN);
+            temp_history_deque_push(&history->max_entries[window_offsets[l_index]], window_sizes[l_index],
+                                    &l_window->max_head, &l_window->max_count,
+                                    history->sequence, history->newest_value, TEMP_HISTORY_DEQUE_MAX);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the minimum, maximum and average of a window.
+ * 
+ * @param history A pointer to the history.
+ * @param window The index of the window in TEMP_HISTORY_WINDOW_SIZES.
+ * @param stats A pointer to store the statistics (samples_num is 0 if the history is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_get_stats(const temp_history_t *history, uint8 window, temp_history_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    const temp_history_window_t *l_window = NULL;
+    sint32 l_half = ZERO_INIT;
+
+    if(NULL == history || NULL == stats || window >= TEMP_HISTORY_WINDOWS_NUM)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_window = &history->windows[window];
+        stats->samples_num = (history->count < window_sizes[window]) ? history->count : window_sizes[window];
+        if(ZERO_INIT == stats->samples_num)
+        {
+            stats->min = ZERO_INIT;
+            stats->max = ZERO_INIT;
+            stats->average = ZERO_INIT;
+        }
+        else
+        {
+            //The fronts of the deques are the extremes of the window
+            stats->min = history->min_entries[window_offsets[window] + l_window->min_head].value;
+            stats->max = history->max_entries[window_offsets[window] + l_window->max_head].value;
+            l_half = (l_window->sum < 0) ? -(sint32)(stats->samples_num / 2) : (sint32)(stats->samples_num / 2);
+            stats->average = (sint16)((l_window->sum + l_half) / stats->samples_num);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Places a cursor on the first of the last samples_num samples.
+ * 
+ * @param history A pointer to the history.
+ * @param samples_num The number of samples to read, limited to the samples in the history.
+ * @param cursor A pointer to store the cursor, remaining is 0 after the last one.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or the history is empty).
+ */
+Std_ReturnType temp_history_seek(const temp_history_t *history, uint8 samples_num, temp_history_cursor_t *cursor)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_steps = ZERO_INIT;
+
+    if(NULL == history || NULL == cursor || ZERO_INIT == history->count || ZERO_INIT == samples_num)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(samples_num > history->count)
+        {
+            samples_num = history->count;
+        }
+        //Walk back from the newest sample undoing the deltas
+        cursor->slot = (uint8)((history->oldest_slot + history->count - 1) % TEMP_HISTORY_SIZE);
+        cursor->value = history->newest_value;
+        for(l_steps = 1; l_steps < samples_num; l_steps++)
+        {
+            cursor->value -= history->deltas[cursor->slot];
+            cursor->slot = (uint8)((cursor->slot + TEMP_HISTORY_SIZE - 1) % TEMP_HISTORY_SIZE);
+        }
+        cursor->remaining = samples_num - 1;
+    }
+    return ret;
+}
+
+/**
+ * @brief Moves the cursor to the next sample.
+ * 
+ * @param history A pointer to the history.
+ * @param cursor A pointer to the cursor.
+ * @param delta A pointer to store the change from the previous sample (the encoded byte).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or no sample is left).
+ */
+Std_ReturnType temp_history_next(const temp_history_t *history, temp_history_cursor_t *cursor, sint8 *delta)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == history || NULL == cursor || NULL == delta || ZERO_INIT == cursor->remaining)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        cursor->slot = (uint8)((cursor->slot + 1) % TEMP_HISTORY_SIZE);
+        *delta = history->deltas[cursor->slot];
+        cursor->value += *delta;
+        cursor->remaining--;
+    }
+    return ret;
+}
+
+/**
+ * @brief Adds a sample to a monotonic deque of a window.
+ * 
+ * The entry that left the window is dropped from the front, then the entries that can't be the
+ * extreme anymore (not smaller for the minimum, not greater for the maximum) from the back.
+ * Every sample enters and leaves once, so the cost is O(1) amortized.
+ */
+static void temp_history_deque_push(temp_history_entry_t *entries, uint8 size, uint8 *head, uint8 *count,
+                                    uint8 sequence, sint16 value, uint8 deque_type)
+{
+    uint8 l_back = ZERO_INIT;
+
+    if((*count > ZERO_INIT) && ((uint8)(sequence - entries[*head].sequence) >= size))
+    {
+        *head = (uint8)((*head + 1) % size);
+        (*count)--;
+    }
+    while(*count > ZERO_INIT)
+    {
+        l_back = (uint8)((*head + *count - 1) % size);
+        if(((TEMP_HISTORY_DEQUE_MIN == deque_type) && (entries[l_back].value < value)) ||
+           ((TEMP_HISTORY_DEQUE_MAX == deque_type) && (entries[l_back].value > value)))
+        {
+            break;
+        }
+        (*count)--;
+    }
+    l_back = (uint8)((*head + *count) % size);
+    entries[l_back].value = value;
+    entries[l_back].sequence = sequence;
+    (*count)++;
+}
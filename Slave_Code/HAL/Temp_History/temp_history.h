@@ -0,0 +1,138 @@
+/* 
+ * File:   temp_history.h
+ * Author: Mohamed Sameh
+ * Description:
+ * This header file defines a fixed-size history of temperature samples taken every
+ * TEMP_HISTORY_PERIOD_S. Samples are delta-encoded: the ring keeps one signed byte per sample
+ * (the change from the previous sample, clamped to +/-12.7 degrees) plus the absolute value of the
+ * oldest and the newest sample. The time of a sample follows from its position and the time of
+ * the newest one.
+ * 
+ * Every statistics window keeps a running sum and a cursor on its oldest sample (moved forward by
+ * adding the next delta), and two monotonic deques for the minimum and the maximum, so a push costs
+ * O(1) amortized per window and a query O(1).
+ * 
+ * Created on October 19, 2026, 11:30 AM
+ */
+
+#ifndef TEMP_HISTORY_H
+#define	TEMP_HISTORY_H
+
+/* Section : Includes */
+#include "../../MCAL/std_types.h"
+#include "temp_history_cfg.h"
+
+/* Section : Macro Declarations */
+#define TEMP_HISTORY_DELTA_MAX      (sint16)127
+#define TEMP_HISTORY_DELTA_MIN      (sint16)(-127)
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+typedef struct
+{
+    sint16 value;
+    uint8 sequence;             // Sequence number of the sample (wraps, windows are shorter than 256)
+}temp_history_entry_t;
+
+typedef struct
+{
+    sint32 sum;                 // Sum of the samples in the window
+    sint16 trailing_value;      // Oldest sample in the window
+    uint8 trailing_slot;        // Ring slot of the oldest sample in the window
+    uint8 min_head;             // The deques are rings inside the entries pools
+    uint8 min_count;
+    uint8 max_head;
+    uint8 max_count;
+}temp_history_window_t;
+
+typedef struct
+{
+    sint8 deltas[TEMP_HISTORY_SIZE];    // Change of every sample from the previous one
+    sint16 oldest_value;
+    sint16 newest_value;
+    uint32 newest_timestamp;            // Time of the newest sample as given to temp_history_push()
+    uint8 oldest_slot;
+    uint8 count;
+    uint8 sequence;                     // Sequence number of the newest sample
+    temp_history_window_t windows[TEMP_HISTORY_WINDOWS_NUM];
+    temp_history_entry_t min_entries[TEMP_HISTORY_WINDOWS_TOTAL];
+    temp_history_entry_t max_entries[TEMP_HISTORY_WINDOWS_TOTAL];
+}temp_history_t;
+
+typedef struct
+{
+    sint16 min;
+    sint16 max;
+    sint16 average;             // Rounded to the nearest tenth
+    uint8 samples_num;          // Samples in the window so far
+}temp_history_stats_t;
+
+/* Reads the samples from the oldest requested one to the newest one */
+typedef struct
+{
+    sint16 value;               // Value of the sample at the cursor
+    uint8 slot;
+    uint8 remaining;            // Samples after the cursor
+}temp_history_cursor_t;
+
+/* Section : Functions Declarations */
+/**
+ * @brief Empties the history.
+ * 
+ * @param history A pointer to the history.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_init(temp_history_t *history);
+
+/**
+ * @brief Adds a sample, the oldest one is dropped when the history is full.
+ * 
+ * @param history A pointer to the history.
+ * @param value The temperature in tenths of a degree.
+ * @param timestamp The time of the sample in seconds.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_push(temp_history_t *history, sint16 value, uint32 timestamp);
+
+/**
+ * @brief Reads the minimum, maximum and average of a window.
+ * 
+ * @param history A pointer to the history.
+ * @param window The index of the window in TEMP_HISTORY_WINDOW_SIZES.
+ * @param stats A pointer to store the statistics (samples_num is 0 if the history is empty).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_history_get_stats(const temp_history_t *history, uint8 window, temp_history_stats_t *stats);
+
+/**
+ * @brief Places a cursor on the first of the last samples_num samples.
+ * 
+ * @param history A pointer to the history.
+ * @param samples_num The number of samples to read, limited to the samples in the history.
+ * @param cursor A pointer to store the cursor, remaining is 0 after the last one.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or the history is empty).
+ */
+Std_ReturnType temp_history_seek(const temp_history_t *history, uint8 samples_num, temp_history_cursor_t *cursor);
+
+/**
+ * @brief Moves the cursor to the next sample.
+ * 
+ * @param history A pointer to the history.
+ * @param cursor A pointer to the cursor.
+ * @param delta A pointer to store the change from the previous sample (the encoded byte).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation (or no sample is left).
+ */
+Std_ReturnType temp_history_next(const temp_history_t *history, temp_history_cursor_t *cursor, sint8 *delta);
+
+#endif	/* TEMP_HISTORY_H */
@@ -0,0 +1,28 @@
+/* 
+ * File:   temp_history_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 11:30 AM
+ */
+
+#ifndef TEMP_HISTORY_CFG_H
+#define	TEMP_HISTORY_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define TEMP_HISTORY_SIZE           128U    // Samples kept in the ring (1 byte each), at most 255
+#define TEMP_HISTORY_PERIOD_S       10U     // Seconds between two samples, 128 samples cover 21 min
+
+/* Statistics windows in samples (1 min, 5 min, whole ring), each at most TEMP_HISTORY_SIZE */
+#define TEMP_HISTORY_WINDOWS_NUM    3U
+#define TEMP_HISTORY_WINDOW_SIZES   {6U, 30U, TEMP_HISTORY_SIZE}
+#define TEMP_HISTORY_WINDOWS_TOTAL  (6U + 30U + TEMP_HISTORY_SIZE)  // Sum of the sizes above
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* TEMP_HISTORY_CFG_H */
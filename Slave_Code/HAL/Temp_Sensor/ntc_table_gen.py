@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+#
+# File:   ntc_table_gen.py
+# Author: Mohamed Sameh
+#
+# Generates temp_sensor_ntc_table.h, the linearization table of the NTC thermistor inputs, from the
+# Steinhart-Hart coefficients of the thermistor: 1/T = A + B*ln(R) + C*ln(R)^3 (T in kelvin).
+# The thermistor is the low side of a divider with a fixed resistor to VREF, so the decimated
+# result r (0 .. 4095) gives R = R_FIXED * r / (4096 - r) and the code rises as the room cools.
+#
+# Run it again after changing the thermistor, the fixed resistor or the segment size:
+#     python3 ntc_table_gen.py > temp_sensor_ntc_table.h
+#
+# Created on October 19, 2026, 3:30 PM
+
+import math
+
+# 10k B3950 thermistor
+SH_A = 1.009249522e-3
+SH_B = 2.378405444e-4
+SH_C = 2.019202697e-7
+R_FIXED = 10000.0           # Ohms, from the ADC input to VREF
+
+RESULT_BITS = 12            # TEMP_SENSOR_RESULT_FULL_SCALE = 4096 (10-bit ADC + 2 oversampling bits)
+SEGMENT_BITS = 6            # 64 codes per segment, 65 entries
+DECI_MIN = -400             # The table is clamped to the range of the thermistor (-40.0 .. 125.0)
+DECI_MAX = 1250
+
+
+def deci_celsius(code):
+    full_scale = 1 << RESULT_BITS
+    if code <= 0:
+        return DECI_MAX     # Shorted thermistor
+    if code >= full_scale:
+        return DECI_MIN     # Open thermistor
+    resistance = R_FIXED * code / (full_scale - code)
+    ln_r = math.log(resistance)
+    kelvin = 1.0 / (SH_A + SH_B * ln_r + SH_C * ln_r ** 3)
+    return max(DECI_MIN, min(DECI_MAX, round((kelvin - 273.15) * 10)))
+
+
+def main():
+    segment = 1 << SEGMENT_BITS
+    entries = ((1 << RESULT_BITS) >> SEGMENT_BITS) + 1
+    table = [deci_celsius(i * segment) for i in range(entries)]
+    max_step = max(table[i] - table[i + 1] for i in range(entries - 1))
+    assert min(table[i] - table[i + 1] for i in range(entries - 1)) >= 0, "the table must not rise"
+    # The interpolation multiplies a step by the offset inside the segment in 16 bits
+    assert max_step * (segment - 1) <= 0xFFFF, "segment too wide for a 16-bit product"
+
+    print("/* ")
+    print(" * File:   temp_sensor_ntc_table.h")
+    print(" * Author: Mohamed Sameh")
+    print(" * Description:")
+    print(" * Generated by ntc_table_gen.py, don't edit. Included by temp_sensor.c only.")
+    print(" * Steinhart-Hart A = %.9e, B = %.9e, C = %.9e, fixed resistor %d Ohm." % (SH_A, SH_B, SH_C, R_FIXED))
+    print(" * Entry i is the temperature in tenths of a degree at the result i * %d." % segment)
+    print(" * ")
+    print(" * Created on October 19, 2026, 3:30 PM")
+    print(" */")
+    print()
+    print("#ifndef TEMP_SENSOR_NTC_TABLE_H")
+    print("#define\tTEMP_SENSOR_NTC_TABLE_H")
+    print()
+    print("#define TEMP_SENSOR_NTC_SEGMENT_BITS    %dU" % SEGMENT_BITS)
+    print("#define TEMP_SENSOR_NTC_TABLE_SIZE      %dU" % entries)
+    print("#define TEMP_SENSOR_NTC_MAX_STEP        %dU      // Largest drop between two entries" % max_step)
+    print()
+    print("static const sint16 temp_sensor_ntc_table[TEMP_SENSOR_NTC_TABLE_SIZE] =")
+    print("{")
+    for row in range(0, entries, 8):
+        values = ", ".join("%5d" % v for v in table[row:row + 8])
+        comma = "," if row + 8 < entries else ""
+        print("    %s%s" % (values, comma))
+    print("};")
+    print()
+    print("#endif\t/* TEMP_SENSOR_NTC_TABLE_H */")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,301 @@
+/* 
+ * File:   temp_sensor.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 5:30 AM
+ */
+
+#include "temp_sensor.h"
+#include "temp_sensor_ntc_table.h"
+
+#if ((TEMP_SENSOR_NTC_TABLE_SIZE - 1U) << TEMP_SENSOR_NTC_SEGMENT_BITS) != (TEMP_SENSOR_ADC_FULL_SCALE << TEMP_SENSOR_OVERSAMPLE_BITS)
+#error "The NTC table doesn't cover the result range, run ntc_table_gen.py"
+#endif
+
+/**
+ * @brief Adds a conversion to the decimation block, every TEMP_SENSOR_OVERSAMPLE_NUM conversions
+ *        it outputs their sum shifted by TEMP_SENSOR_OVERSAMPLE_BITS (cheap enough for the ADC interrupt).
+ * 
+ * @param decimator A pointer to the oversampling state of the channel.
+ * @param adc_res The raw ADC result.
+ * @param decimated A pointer to store the decimated result.
+ * @param result_status A pointer to store the status (@ref TEMP_SENSOR_RESULT_READY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_oversample(temp_sensor_decimator_t *decimator, uint16 adc_res, 
+                                      uint16 *decimated, uint8 *result_status)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == decimator || NULL == decimated || NULL == result_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        decimator->accumulator += adc_res;
+        decimator->samples_num++;
+        if(decimator->samples_num >= TEMP_SENSOR_OVERSAMPLE_NUM)
+        {
+            *decimated = decimator->accumulator >> TEMP_SENSOR_OVERSAMPLE_BITS;
+            decimator->accumulator = ZERO_INIT;
+            decimator->samples_num = ZERO_INIT;
+            *result_status = TEMP_SENSOR_RESULT_READY;
+        }
+        else
+        {
+            *result_status = TEMP_SENSOR_RESULT_NOT_READY;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Runs the IIR low-pass on a decimated result, the first result primes the filter.
+ * 
+ * @param filter A pointer to the IIR state of the channel.
+ * @param decimated The decimated result.
+ * @param filtered A pointer to store the filtered result (same scale as the decimated one).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_iir(temp_sensor_iir_t *filter, uint16 decimated, uint16 *filtered)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == filter || NULL == filtered)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(ZERO_INIT == filter->primed)
+        {
+            //Start from the first value instead of ramping up from zero
+            filter->iir_state = (uint16)(decimated << TEMP_SENSOR_IIR_SHIFT);
+            filter->primed = 1;
+        }
+        else
+        {
+            //The state keeps the fraction bits so the output doesn't stick below the input
+            filter->iir_state = (uint16)(filter->iir_state - (filter->iir_state >> TEMP_SENSOR_IIR_SHIFT) + decimated);
+        }
+        *filtered = (uint16)((filter->iir_state + (1U << (TEMP_SENSOR_IIR_SHIFT - 1))) >> TEMP_SENSOR_IIR_SHIFT);
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a decimated (or filtered) result of the sensor to tenths of a degree Celsius.
+ * 
+ * The result is rounded to the nearest tenth: deci = (res * factor + half) >> (8 + oversample bits).
+ * 
+ * @param adc_res The decimated result of the sensor channel.
+ * @param deci_celsius A pointer to store the temperature in tenths of a degree Celsius.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_to_deci_celsius(uint16 adc_res, sint16 *deci_celsius)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == deci_celsius || adc_res >= TEMP_SENSOR_RESULT_FULL_SCALE)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //4095 * 1250 doesn't fit in 16 bits, the product is done in 32 bits
+        *deci_celsius = (sint16)((((uint32)adc_res * TEMP_SENSOR_Q8_8_FACTOR) + TEMP_SENSOR_Q8_8_HALF) >> TEMP_SENSOR_Q8_8_SHIFT);
+    }
+    return ret;
+}
+
+#if TEMP_SENSOR_FLOAT_REFERENCE
+/**
+ * @brief The float conversion the Q8.8 one replaced, ADC_STEP * res / 10, kept to measure its cost.
+ * 
+ * @param adc_res The decimated result of the sensor channel.
+ * @param deci_celsius A pointer to store the temperature in tenths of a degree Celsius (truncated).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_float_to_deci_celsius(uint16 adc_res, sint16 *deci_celsius)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_reading = ZERO_INIT;
+
+    if(NULL == deci_celsius || adc_res >= TEMP_SENSOR_RESULT_FULL_SCALE)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The same steps as the old code: to float, multiply, back to uint16, then the division by 10
+        l_reading = (uint16)(TEMP_SENSOR_FLOAT_STEP * adc_res);
+        l_reading /= 10;
+        *deci_celsius = (sint16)l_reading;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief Converts an NTC divider result to tenths of a degree Celsius by table interpolation.
+ *        Results beyond the table range read as its limits (-40.0 .. 125.0).
+ * 
+ * @param adc_res The filtered result (0 .. TEMP_SENSOR_RESULT_FULL_SCALE - 1).
+ * @param deci_celsius A pointer to store the temperature in tenths of a degree.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_ntc_to_deci_celsius(uint16 adc_res, sint16 *deci_celsius)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_index = ZERO_INIT, l_offset = ZERO_INIT;
+    uint16 l_step = ZERO_INIT;
+
+    if(NULL == deci_celsius || adc_res >= TEMP_SENSOR_RESULT_FULL_SCALE)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_index = (uint8)(adc_res >> TEMP_SENSOR_NTC_SEGMENT_BITS);
+        l_offset = (uint8)(adc_res & ((1U << TEMP_SENSOR_NTC_SEGMENT_BITS) - 1U));
+        //The table falls as the code rises, the step is positive and fits the 16-bit product
+        l_step = (uint16)(temp_sensor_ntc_table[l_index] - temp_sensor_ntc_table[l_index + 1]);
+        *deci_celsius = temp_sensor_ntc_table[l_index] -
+                        (sint16)(((l_step * l_offset) + (1U << (TEMP_SENSOR_NTC_SEGMENT_BITS - 1U))) >> TEMP_SENSOR_NTC_SEGMENT_BITS);
+    }
+    return ret;
+}
+
+/**
+ * @brief Converts a filtered result with the conversion of the sensor fitted on its channel.
+ * 
+ * @param type The sensor of the channel.
+ * @param adc_res The filtered result (0 .. TEMP_SENSOR_RESULT_FULL_SCALE - 1).
+ * @param deci_celsius A pointer to store the temperature in tenths of a degree.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_linearize(temp_sensor_type_t type, uint16 adc_res, sint16 *deci_celsius)
+{
+    Std_ReturnType ret = E_OK;
+
+    switch(type)
+    {
+        case TEMP_SENSOR_LM35:
+            ret = temp_sensor_to_deci_celsius(adc_res, deci_celsius);
+            break;
+        case TEMP_SENSOR_NTC:
+            ret = temp_sensor_ntc_to_deci_celsius(adc_res, deci_celsius);
+            break;
+        default:
+            ret = E_NOT_OK;
+            break;
+    }
+    return ret;
+}
+
+/**
+ * @brief Applies the calibration of a channel to its reading, one multiplication and a shift.
+ * 
+ * @param calib A pointer to the calibration of the channel.
+ * @param raw_deci The uncalibrated reading in tenths of a degree.
+ * @param deci_celsius A pointer to store the calibrated reading in tenths of a degree.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType temp_sensor_calibrate(const temp_sensor_calib_t *calib, sint16 raw_deci, sint16 *deci_celsius)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_scaled = ZERO_INIT;
+
+    if(NULL == calib || NULL == deci_celsius)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The magnitude is scaled so the rounding and the shift don't depend on how signed values shift
+        if(raw_deci < 0)
+        {
+            l_scaled = (((uint32)(-raw_deci) * calib->gain_q14) + (TEMP_SENSOR_GAIN_ONE / 2U)) >> TEMP_SENSOR_GAIN_SHIFT;
+            *deci_celsius = (sint16)(calib->offset_deci - (sint16)l_scaled);
+        }
+        else
+        {
+            l_scaled = (((uint32)raw_deci * calib->gain_q14) + (TEMP_SENSOR_GAIN_ONE / 2U)) >> TEMP_SENSOR_GAIN_SHIFT;
+            *deci_celsius = (sint16)(calib->offset_deci + (sint16)l_scaled);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Computes the calibration that maps two uncalibrated readings to their reference temperatures.
+ * 
+ * @param raw_low The uncalibrated reading at the first reference point.
+ * @param ref_low The first reference temperature in tenths of a degree.
+ * @param raw_high The uncalibrated reading at the second reference point.
+ * @param ref_high The second reference temperature in tenths of a degree.
+ * @param calib A pointer to store the calibration, unchanged on failure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: The points are too close or the gain is out of range.
+ */
+Std_ReturnType temp_sensor_calib_two_point(sint16 raw_low, sint16 ref_low, sint16 raw_high, sint16 ref_high,
+                                           temp_sensor_calib_t *calib)
+{
+    Std_ReturnType ret = E_OK;
+    sint32 l_raw_span = ZERO_INIT, l_ref_span = ZERO_INIT, l_gain = ZERO_INIT;
+    temp_sensor_calib_t l_calib;
+
+    if(NULL == calib)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_raw_span = (sint32)raw_high - raw_low;
+        l_ref_span = (sint32)ref_high - ref_low;
+        if(l_raw_span < 0)//the points may come in any order
+        {
+            l_raw_span = -l_raw_span;
+            l_ref_span = -l_ref_span;
+        }
+        if((l_raw_span < TEMP_SENSOR_CALIB_MIN_SPAN) || (l_ref_span <= 0))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            //The only division of the calibration path, done once per calibration
+            l_gain = ((l_ref_span << TEMP_SENSOR_GAIN_SHIFT) + (l_raw_span / 2)) / l_raw_span;
+            if((l_gain < TEMP_SENSOR_GAIN_MIN) || (l_gain > TEMP_SENSOR_GAIN_MAX))
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                //The offset makes the first point exact: ref_low = raw_low * gain + offset
+                l_calib.gain_q14 = (uint16)l_gain;
+                l_calib.offset_deci = ZERO_INIT;
+                ret = temp_sensor_calibrate(&l_calib, raw_low, &l_calib.offset_deci);
+                l_calib.offset_deci = ref_low - l_calib.offset_deci;
+                *calib = l_calib;
+            }
+        }
+    }
+    return ret;
+}
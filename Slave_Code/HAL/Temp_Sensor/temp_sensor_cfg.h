@@ -0,0 +1,35 @@
+/* 
+ * File:   temp_sensor_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 5:30 AM
+ */
+
+#ifndef TEMP_SENSOR_CFG_H
+#define	TEMP_SENSOR_CFG_H
+
+/* Section : Includes */
+
+/* Section : Macro Declarations */
+#define TEMP_SENSOR_VREF_MV             5000UL  // ADC reference voltage (VDD) in mV
+#define TEMP_SENSOR_ADC_FULL_SCALE      1024UL  // Number of ADC codes (10-bit result)
+#define TEMP_SENSOR_MV_PER_DEGREE       10UL    // LM35 output slope in mV per degree Celsius
+
+/*
+ * Oversampling: 4^N conversions are summed and shifted right by N to gain N bits.
+ * The extra bits are real only if the input noise dithers the result over at least 1 LSB.
+ */
+#define TEMP_SENSOR_OVERSAMPLE_BITS     2U      // 16 conversions per 12-bit result
+/* IIR low-pass on the decimated stream: y += (x - y) / 2^K */
+#define TEMP_SENSOR_IIR_SHIFT           3U      // alpha = 1/8
+/* 1 links the float conversion the Q8.8 one replaced, only to measure both on the target (GET_CONVERT_LOAD) */
+#define TEMP_SENSOR_FLOAT_REFERENCE     0U
+
+/* Section : Macro Functions Declarations */
+
+/* Section : Data Types Declarations  */
+
+/* Section : Functions Declarations */
+
+#endif	/* TEMP_SENSOR_CFG_H */
+
@@ -0,0 +1,32 @@
+/* 
+ * File:   temp_sensor_ntc_table.h
+ * Author: Mohamed Sameh
+ * Description:
+ * Generated by ntc_table_gen.py, don't edit. Included by temp_sensor.c only.
+ * Steinhart-Hart A = 1.009249522e-03, B = 2.378405444e-04, C = 2.019202697e-07, fixed resistor 10000 Ohm.
+ * Entry i is the temperature in tenths of a degree at the result i * 64.
+ * 
+ * Created on October 19, 2026, 3:30 PM
+ */
+
+#ifndef TEMP_SENSOR_NTC_TABLE_H
+#define	TEMP_SENSOR_NTC_TABLE_H
+
+#define TEMP_SENSOR_NTC_SEGMENT_BITS    6U
+#define TEMP_SENSOR_NTC_TABLE_SIZE      65U
+#define TEMP_SENSOR_NTC_MAX_STEP        121U      // Largest drop between two entries
+
+static const sint16 temp_sensor_ntc_table[TEMP_SENSOR_NTC_TABLE_SIZE] =
+{
+     1250,  1250,  1250,  1219,  1098,  1007,   934,   874,
+      822,   776,   735,   698,   664,   633,   604,   577,
+      551,   527,   504,   482,   460,   440,   420,   401,
+      383,   364,   347,   329,   312,   296,   279,   263,
+      247,   231,   215,   199,   183,   168,   152,   136,
+      120,   104,    88,    71,    55,    38,    20,     2,
+      -16,   -35,   -54,   -75,   -96,  -118,  -142,  -168,
+     -195,  -226,  -259,  -298,  -342,  -398,  -400,  -400,
+     -400
+};
+
+#endif	/* TEMP_SENSOR_NTC_TABLE_H */
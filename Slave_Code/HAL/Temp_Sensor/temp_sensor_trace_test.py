@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+#
+# File:   temp_sensor_trace_test.py
+# Author: Mohamed Sameh
+#
+# Host test of the sampling stage: builds temp_sensor.c with the host C compiler, feeds it an ADC
+# trace of one LM35 channel (one raw 10-bit code per line, '#' starts a comment) and prints the
+# noise of the raw, decimated and filtered readings on the steady part of the trace, the offset of
+# the reading, the 10-90 % time of the step and the CPU budget from the cycle macros of temp_sensor.h.
+#
+# The trace holds the conversions of one channel in order, one every --period-ms (20 ms: the scan
+# converts 4 channels, one every 5 ms). It can come from a capture of the ADC results over the
+# EUSART or from --generate, which writes a synthetic trace (fixed seed, 24.0 C then a step to
+# 26.0 C, 1 LSB Gaussian noise and rare spikes):
+#     python3 temp_sensor_trace_test.py --generate > adc_trace_lm35.txt
+#     python3 temp_sensor_trace_test.py adc_trace_lm35.txt
+#
+# Created on October 19, 2026, 11:40 PM
+
+import argparse
+import math
+import os
+import random
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+VREF_MV = 5000.0            # TEMP_SENSOR_VREF_MV
+ADC_FULL_SCALE = 1024       # TEMP_SENSOR_ADC_FULL_SCALE
+MV_PER_DEGREE = 10.0        # TEMP_SENSOR_MV_PER_DEGREE
+OVERSAMPLE_NUM = 16         # TEMP_SENSOR_OVERSAMPLE_NUM
+RESULT_SCALE = 4            # The decimated result has 2 more bits
+DEGREE_PER_CODE = VREF_MV / ADC_FULL_SCALE / MV_PER_DEGREE
+
+INSTRUCTIONS_PER_S = 2000000    # 8 MHz / 4
+SCAN_CONVERSION_MS = 5.0        # One conversion of the scan every 5 ms, whatever the channel
+CHANNELS_NUM = 4
+
+# Synthetic trace
+GEN_SEED = 2026
+GEN_SAMPLES = 3000
+GEN_STEP_AT = 1500
+GEN_LOW_C = 24.0
+GEN_HIGH_C = 26.0
+GEN_NOISE_LSB = 1.0
+GEN_SPIKE_PROB = 0.002
+GEN_SPIKE_LSB = 12
+
+# Reads the codes on stdin, prints "decimated filtered deci" for every decimated result
+DRIVER = r"""
+#include <stdio.h>
+#include "temp_sensor.h"
+
+int main(void)
+{
+    temp_sensor_decimator_t decimator = {0};
+    temp_sensor_iir_t filter = {0};
+    unsigned int code;
+    uint16 decimated, filtered;
+    uint8 status;
+    sint16 deci;
+
+    while(1 == scanf("%u", &code))
+    {
+        temp_sensor_oversample(&decimator, (uint16)code, &decimated, &status);
+        if(TEMP_SENSOR_RESULT_READY == status)
+        {
+            temp_sensor_iir(&filter, decimated, &filtered);
+            temp_sensor_to_deci_celsius(filtered, &deci);
+            printf("%u %u %d\n", decimated, filtered, deci);
+        }
+    }
+    return 0;
+}
+"""
+
+
+def generate():
+    rng = random.Random(GEN_SEED)
+    print("# Synthetic LM35 trace written by temp_sensor_trace_test.py --generate, not a capture.")
+    print("# One channel, one raw 10-bit code per conversion. %.1f C for %d conversions then %.1f C,"
+          % (GEN_LOW_C, GEN_STEP_AT, GEN_HIGH_C))
+    print("# Gaussian noise of %.1f LSB rms, spikes of +-%d LSB with a probability of %.3f, seed %d."
+          % (GEN_NOISE_LSB, GEN_SPIKE_LSB, GEN_SPIKE_PROB, GEN_SEED))
+    for i in range(GEN_SAMPLES):
+        celsius = GEN_LOW_C if i < GEN_STEP_AT else GEN_HIGH_C
+        value = celsius / DEGREE_PER_CODE + rng.gauss(0.0, GEN_NOISE_LSB)
+        if rng.random() < GEN_SPIKE_PROB:
+            value += rng.choice((-GEN_SPIKE_LSB, GEN_SPIKE_LSB))
+        print(max(0, min(ADC_FULL_SCALE - 1, int(round(value)))))
+
+
+def read_trace(path):
+    codes = []
+    with open(path) as trace:
+        for line in trace:
+            line = line.split("#", 1)[0].strip()
+            if line:
+                codes.append(int(line))
+    return codes
+
+
+def run_filter(codes):
+    work = tempfile.mkdtemp()
+    try:
+        # temp_sensor.c only needs the types of <xc.h>, no register
+        open(os.path.join(work, "xc.h"), "w").close()
+        driver = os.path.join(work, "driver.c")
+        with open(driver, "w") as source:
+            source.write(DRIVER)
+        binary = os.path.join(work, "driver")
+        subprocess.run([os.environ.get("CC", "cc"), "-std=c99", "-Wall", "-I", work, "-I", HERE,
+                        "-o", binary, driver, os.path.join(HERE, "temp_sensor.c")], check=True)
+        output = subprocess.run([binary], input="\n".join(map(str, codes)) + "\n",
+                                capture_output=True, text=True, check=True).stdout
+    finally:
+        shutil.rmtree(work)
+    return [tuple(int(v) for v in line.split()) for line in output.splitlines()]
+
+
+def rms(values):
+    mean = sum(values) / len(values)
+    return math.sqrt(sum((v - mean) ** 2 for v in values) / len(values)), mean
+
+
+def header_cycles():
+    with open(os.path.join(HERE, "temp_sensor.h")) as header:
+        text = header.read()
+    return {name: int(value) for name, value in
+            re.findall(r"#define\s+TEMP_SENSOR_(\w+)_CYCLES\s+(\d+)UL", text)}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("trace", nargs="?", default=os.path.join(HERE, "adc_trace_lm35.txt"))
+    parser.add_argument("--generate", action="store_true", help="write a synthetic trace to stdout")
+    parser.add_argument("--period-ms", type=float, default=SCAN_CONVERSION_MS * CHANNELS_NUM,
+                        help="conversion period of the channel")
+    parser.add_argument("--settle", type=int, default=16, help="decimated results skipped after a change")
+    args = parser.parse_args()
+    if args.generate:
+        generate()
+        return 0
+
+    codes = read_trace(args.trace)
+    results = run_filter(codes)
+    result_ms = args.period_ms * OVERSAMPLE_NUM
+
+    # The steady part ends at the first decimated result that moves more than 1 C from the start
+    start = results[0][1]
+    change = next((i for i, r in enumerate(results)
+                   if abs(r[0] - start) * DEGREE_PER_CODE / RESULT_SCALE > 1.0), len(results))
+    steady = range(args.settle, max(args.settle + 2, change - 1))
+    steady_codes = codes[steady.start * OVERSAMPLE_NUM:steady.stop * OVERSAMPLE_NUM]
+
+    raw_rms, raw_mean = rms([c * DEGREE_PER_CODE for c in steady_codes])
+    dec_rms, _ = rms([results[i][0] * DEGREE_PER_CODE / RESULT_SCALE for i in steady])
+    fil_rms, _ = rms([results[i][1] * DEGREE_PER_CODE / RESULT_SCALE for i in steady])
+    deci_rms, deci_mean = rms([results[i][2] / 10.0 for i in steady])
+
+    print("trace: %s, %d conversions, %d decimated results, %.0f ms per result"
+          % (os.path.basename(args.trace), len(codes), len(results), result_ms))
+    print("steady part: results %d..%d" % (steady.start, steady.stop - 1))
+    print("  raw        rms %.3f C" % raw_rms)
+    print("  decimated  rms %.3f C  (%.1fx less)" % (dec_rms, raw_rms / dec_rms))
+    print("  filtered   rms %.3f C  (%.1fx less)" % (fil_rms, raw_rms / fil_rms))
+    print("  reading    rms %.3f C, mean %.2f C, raw mean %.2f C, offset %+.2f C"
+          % (deci_rms, deci_mean, raw_mean, deci_mean - raw_mean))
+
+    if change < len(results):
+        low = sum(results[i][1] for i in steady) / len(steady)
+        high = sum(r[1] for r in results[-args.settle:]) / args.settle
+        rising = [r[1] for r in results[change - 1:]]
+        at_10 = next(i for i, v in enumerate(rising) if (v - low) >= 0.1 * (high - low))
+        at_90 = next(i for i, v in enumerate(rising) if (v - low) >= 0.9 * (high - low))
+        print("step %.2f C -> %.2f C: 10-90 %% in %.2f s (%d results)"
+              % (low * DEGREE_PER_CODE / RESULT_SCALE, high * DEGREE_PER_CODE / RESULT_SCALE,
+                 (at_90 - at_10) * result_ms / 1000.0, at_90 - at_10))
+
+    cycles = header_cycles()
+    isr = ((OVERSAMPLE_NUM - 1) * cycles["OVERSAMPLE"] + cycles["OVERSAMPLE_LAST"]) / OVERSAMPLE_NUM
+    main_loop = cycles["IIR"] + cycles["CONVERT"]
+    conversions_s = CHANNELS_NUM * 1000.0 / args.period_ms
+    isr_share = isr * conversions_s / INSTRUCTIONS_PER_S
+    main_share = main_loop * conversions_s / OVERSAMPLE_NUM / INSTRUCTIONS_PER_S
+    print("CPU at 8 MHz, %d channels:" % CHANNELS_NUM)
+    print("  oversampling %.0f cycles per conversion, %.2f %%" % (isr, 100.0 * isr_share))
+    print("  IIR + Q8.8   %d cycles per result, %.2f %%" % (main_loop, 100.0 * main_share))
+    float_share = (cycles["IIR"] + cycles["FLOAT_CONVERT"]) * conversions_s / OVERSAMPLE_NUM / INSTRUCTIONS_PER_S
+    print("  (with the float conversion %.2f %%)" % (100.0 * float_share))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
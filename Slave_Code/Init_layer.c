@@ -10,24 +10,58 @@
 
 Std_ReturnType ret = E_NOT_OK;
 
-led_t Room1_led = {.led_status = LED_OFF, .pin = GPIO_PIN0, .port = PORTB_INDEX};
-led_t Room2_led = {.led_status = LED_OFF, .pin = GPIO_PIN1, .port = PORTB_INDEX};
-led_t Room3_led = {.led_status = LED_OFF, .pin = GPIO_PIN2, .port = PORTB_INDEX};
-led_t Room4_led = {.led_status = LED_OFF, .pin = GPIO_PIN3, .port = PORTB_INDEX};
+/* Room1..4, TV and air conditioning on RB0..RB5, all off at startup */
+led_bank_t Devices_bank = {.port = PORTB_INDEX, .mask = 0x3F, .state = 0x00};
 
-led_t TV_led       = {.led_status = LED_OFF, .pin = GPIO_PIN4, .port = PORTB_INDEX};
-led_t Air_Cond_led = {.led_status = LED_OFF, .pin = GPIO_PIN5, .port = PORTB_INDEX};
+/* Dimmable lights of Room1..4, channel n drives RBn */
+soft_pwm_t Rooms_pwm = 
+{
+    .bank = &Devices_bank,
+    .channel_mask = {0x01, 0x02, 0x04, 0x08}
+};
 
 
+/* Tad = 1us at 8 MHz, the acquisition is done by the hardware after GO is set */
 adc_config_t adc0 = 
 {
-    //.ADC_InterruptHandler = NULL,
-    .acq_time = ADC_0_TAD,
+    .ADC_InterruptHandler = ADC_InterruptHandler,
+    .acq_time = ADC_12_TAD,
     .channel = ADC_CHANNEL_AN0,
     .res_format = ADC_RESULT_RIGHT,
-    .clock = ADC_CLOCK_FOSC_DIV_2,
+    .clock = ADC_CLOCK_FOSC_DIV_8,
     .volt_reference = ADC_VOLT_REF_DISABLE
 };
+/* Temperature sensors of Room1..4 on AN0..AN3 */
+adc_scan_t Rooms_scan = 
+{
+    .adc = &adc0,
+    .channels = {ADC_CHANNEL_AN0, ADC_CHANNEL_AN1, ADC_CHANNEL_AN2, ADC_CHANNEL_AN3},
+    .analog_pins_cfg = ADC_AN3_ANALOG_FUNCTIONALITY
+};
+/* Sensor fitted on every channel of the scan list, TEMP_SENSOR_NTC for a 10k thermistor to ground
+   with a 10k resistor to VDD (the table of temp_sensor_ntc_table.h) */
+const temp_sensor_type_t Rooms_sensor[ADC_SCAN_CHANNELS_NUM] = 
+{
+    TEMP_SENSOR_LM35, TEMP_SENSOR_LM35, TEMP_SENSOR_LM35, TEMP_SENSOR_LM35
+};
+/* Sampling trigger, the CCP2 special event resets Timer1 and starts the conversion every 5 ms
+   with no software in the path, RC1 stays an input since this mode doesn't drive the pin */
+timer1_t Sampling_timer = 
+{
+    .timer1_preload = 0,
+    .timer1_prescaler_value = TIMER1_PRESCALER_DIV_1,
+    .timer1_mode = TIMER1_TIMER_MODE,
+    .timer1_reg_wr_mode = TIMER1_RW_REG_16BIT_MODE,
+    .timer1_osc_cfg = TIMER1_OSCILLATOR_DISABLE,
+};
+ccp_t Sampling_trigger = 
+{
+    .ccp_inst = CCP2_INST,
+    .ccp_mode = CCP_COMPARE_MODE_SELECTED,
+    .ccp_mode_variant = CCP_COMPARE_MODE_GEN_EVENT,
+    .ccp_pin = {.port = PORTC_INDEX, .pin_num = GPIO_PIN1, .direction = GPIO_DIRECTION_INPUT, .logic = GPIO_LOW},
+    .ccp_capture_timer = CCP1_CCP2_TIMER1,
+};
 spi_t spi = 
 {
     .mode = SPI_SLAVE_SS_DISABLED,
@@ -40,17 +74,40 @@ timer0_t timer =
     .timer0_mode = TIMER0_TIMER_MODE,
     .TMR0_InterruptHandler = TMR0_InterruptHandler,
 };
+/* Air conditioning fan speed, 20 kHz hardware PWM on CCP1 (RC2), PR2 = 99 */
+timer2_t Fan_timer = 
+{
+    .timer2_preload = 0,
+    .timer2_prescaler_value = TIMER2_PRESCALER_DIV_1,
+    .timer2_postscaler_value = TIMER2_POSTSCALER_DIV_1,
+};
+ccp_t Air_cond_fan = 
+{
+    .ccp_inst = CCP1_INST,
+    .ccp_mode = CCP_PWM_MODE_SELECTED,
+    .ccp_mode_variant = CCP_PWM_MODE,
+    .ccp_pin = {.port = PORTC_INDEX, .pin_num = GPIO_PIN2, .direction = GPIO_DIRECTION_OUTPUT, .logic = GPIO_LOW},
+    .PWM_Frequency = 20000,
+    .timer2_prescaler_value = TIMER2_PRESCALER_DIV_1,
+};
        
 void application_init()
 {
    
-   ret = led_init(&Room1_led);
-   ret = led_init(&Room2_led);
-   ret = led_init(&Room3_led);
-   ret = led_init(&Room4_led);
-   ret = led_init(&TV_led);
-   ret = led_init(&Air_Cond_led);
+   ret = led_bank_init(&Devices_bank);
+   ret = soft_pwm_init(&Rooms_pwm);
+   ret = CCP_Init(&Air_cond_fan);
+   ret = Timer2_Init(&Fan_timer);
    
    ret = SPI_Slave_Init(&spi);
+   ret = EEPROM_Init();//the queued writes run in the background from now on
+   ret = EUSART_Init();//diagnostics on RC6/RC7, the writes never wait
    ret = ADC_Init(&adc0);
+   ret = adc_scan_init(&Rooms_scan);
+#if ADC_SCAN_TRIGGER==ADC_SCAN_TRIGGER_CCP2
+   ret = CCP_Compare_Mode_Set_Value(&Sampling_trigger, SAMPLING_PERIOD_COUNTS);
+   ret = CCP_Init(&Sampling_trigger);
+   ret = Timer1_Init(&Sampling_timer);//the first conversion starts one period later
+#endif
+   ret = Timer0_Init(&timer);//the sampling tick runs all the time
 }
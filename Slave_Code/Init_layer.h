@@ -10,12 +10,25 @@
 
 /* Section : Includes */
 #include "HAL/LED/led.h"
+#include "HAL/LED_Bank/led_bank.h"
+#include "HAL/Soft_PWM/soft_pwm.h"
+#include "HAL/Temp_Sensor/temp_sensor.h"
+#include "HAL/ADC_Scan/adc_scan.h"
+#include "HAL/PI_Controller/pi_controller.h"
+#include "HAL/Temp_History/temp_history.h"
 #include "MCAL/interrupt/internal_interrupt.h"
 #include "MCAL/TIMER0/timer0.h"
+#include "MCAL/TIMER1/timer1.h"
+#include "MCAL/TIMER2/timer2.h"
+#include "MCAL/CCP/ccp.h"
 #include "MCAL/SPI/spi.h"
 #include "MCAL/ADC/adc.h"
+#include "MCAL/EEPROM/eeprom.h"
+#include "MCAL/EUSART/eusart.h"
 
 /* Section : Macro Declarations */
+//The CCP2 match resets Timer1, so the sampling period is SAMPLING_PERIOD_COUNTS + 1 counts of Fosc/4
+#define SAMPLING_PERIOD_COUNTS  (uint16)9999 //5 ms at 8 MHz, the same period as the Timer0 tick
 
 /* Section : Macro Functions Declarations */
 
@@ -26,6 +39,7 @@
 /* Section : Functions Declarations */
 void application_init();
 extern void TMR0_InterruptHandler(void);
+extern void ADC_InterruptHandler(void);
 
 #endif	/* INIT_LAYER_H */
 
@@ -0,0 +1,505 @@
+/* 
+ * File:   ccp.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:25 AM
+ */
+
+#include "ccp.h"
+
+#if CCP1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void (*CCP1_InterruptHandler)(void) = NULL;
+#endif
+#if CCP2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void (*CCP2_InterruptHandler)(void) = NULL;
+#endif
+
+static inline void CCP_Set_Mode(const ccp_t *_ccp_obj, uint8 ccp_mode_variant);
+static inline void CCP_Interrupt_Config(const ccp_t *_ccp_obj);
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || \
+    (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+static inline void CCP_Capture_Compare_Timer_Select(const ccp_t *_ccp_obj);
+#endif
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+static inline void CCP_PWM_Period_Config(const ccp_t *_ccp_obj);
+#endif
+
+/**
+ * @brief Initializes the CCP module based on the provided configuration.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Init(const ccp_t *_ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable the CCP module
+        CCP_Set_Mode(_ccp_obj, CCP_MODULE_DISABLE);
+        
+        switch(_ccp_obj->ccp_mode)
+        {
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
+            case CCP_CAPTURE_MODE_SELECTED:
+                CCP_Capture_Compare_Timer_Select(_ccp_obj);
+                CCP_Set_Mode(_ccp_obj, _ccp_obj->ccp_mode_variant);
+                break;
+#endif
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+            case CCP_COMPARE_MODE_SELECTED:
+                CCP_Capture_Compare_Timer_Select(_ccp_obj);
+                CCP_Set_Mode(_ccp_obj, _ccp_obj->ccp_mode_variant);
+                break;
+#endif
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+            case CCP_PWM_MODE_SELECTED:
+                CCP_PWM_Period_Config(_ccp_obj);
+                //The output stays low until a duty cycle is set
+                ret = CCP_PWM_Set_Duty(_ccp_obj, CCP_PWM_DUTY_MIN);
+                CCP_Set_Mode(_ccp_obj, CCP_PWM_MODE);
+                break;
+#endif
+            default:
+                ret = E_NOT_OK;
+                break;
+        }
+        
+        if(E_OK == ret)
+        {
+            //Configure the CCPx pin
+            ret = gpio_pin_initialize(&(_ccp_obj->ccp_pin));
+            //Configure the interrupt
+            CCP_Interrupt_Config(_ccp_obj);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief De-Initializes the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable the CCP module
+        CCP_Set_Mode(_ccp_obj, CCP_MODULE_DISABLE);
+        //Disable the CCP interrupt
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+#if CCP1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+            CCP1_INTERRUPT_DISABLE();
+#endif
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst)
+        {
+#if CCP2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+            CCP2_INTERRUPT_DISABLE();
+#endif
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
+/**
+ * @brief Checks if a new value has been captured.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _capture_status A pointer to store the status (@ref CCP_CAPTURE_READY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_IsCapturedDataReady(const ccp_t *_ccp_obj, uint8 *_capture_status)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj || NULL == _capture_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            *_capture_status = (PIR1bits.CCP1IF) ? CCP_CAPTURE_READY : CCP_CAPTURE_NOT_READY;
+        }
+        else
+        {
+            *_capture_status = (PIR2bits.CCP2IF) ? CCP_CAPTURE_READY : CCP_CAPTURE_NOT_READY;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the captured 16-bit value.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param capture_value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *capture_value)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_reg_t capture_temp_value = {.ccpr_low = 0, .ccpr_high = 0};
+
+    if (NULL == _ccp_obj || NULL == capture_value)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            capture_temp_value.ccpr_low = CCPR1L;
+            capture_temp_value.ccpr_high = CCPR1H;
+        }
+        else
+        {
+            capture_temp_value.ccpr_low = CCPR2L;
+            capture_temp_value.ccpr_high = CCPR2H;
+        }
+        *capture_value = capture_temp_value.ccpr_16bit;
+    }
+    return ret;
+}
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/**
+ * @brief Checks if the compare match has occurred.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _compare_status A pointer to store the status (@ref CCP_COMPARE_READY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_IsCompareComplete(const ccp_t *_ccp_obj, uint8 *_compare_status)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj || NULL == _compare_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            *_compare_status = (PIR1bits.CCP1IF) ? CCP_COMPARE_READY : CCP_COMPARE_NOT_READY;
+        }
+        else
+        {
+            *_compare_status = (PIR2bits.CCP2IF) ? CCP_COMPARE_READY : CCP_COMPARE_NOT_READY;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes the 16-bit compare value.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param compare_value The value to compare with the timer.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Compare_Mode_Set_Value(const ccp_t *_ccp_obj, uint16 compare_value)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_reg_t compare_temp_value = {.ccpr_low = 0, .ccpr_high = 0};
+
+    if (NULL == _ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        compare_temp_value.ccpr_16bit = compare_value;
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            CCPR1L = compare_temp_value.ccpr_low;
+            CCPR1H = compare_temp_value.ccpr_high;
+        }
+        else
+        {
+            CCPR2L = compare_temp_value.ccpr_low;
+            CCPR2H = compare_temp_value.ccpr_high;
+        }
+    }
+    return ret;
+}
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/**
+ * @brief Sets the PWM duty cycle, the hardware applies it at the start of the next period.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _duty The duty cycle in percent (0 .. 100).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Set_Duty(const ccp_t *_ccp_obj, const uint8 _duty)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_duty_temp = ZERO_INIT;
+
+    if (NULL == _ccp_obj || _duty > CCP_PWM_DUTY_MAX)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //10-bit duty = 4 * (PR2 + 1) * duty / 100, integer math only
+        l_duty_temp = (uint16)(((uint32)((uint16)PR2 + 1) * 4U * _duty) / CCP_PWM_DUTY_MAX);
+        if(l_duty_temp > 0x3FF)
+        {
+            l_duty_temp = 0x3FF;
+        }
+        if(CCP1_INST == _ccp_obj->ccp_inst)
+        {
+            CCP1CONbits.DC1B = (uint8)(l_duty_temp & 0x0003);
+            CCPR1L = (uint8)(l_duty_temp >> 2);
+        }
+        else if(CCP2_INST == _ccp_obj->ccp_inst)
+        {
+            CCP2CONbits.DC2B = (uint8)(l_duty_temp & 0x0003);
+            CCPR2L = (uint8)(l_duty_temp >> 2);
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Starts the PWM output of the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Start(const ccp_t *_ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CCP_Set_Mode(_ccp_obj, CCP_PWM_MODE);
+    }
+    return ret;
+}
+
+/**
+ * @brief Stops the PWM output of the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == _ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CCP_Set_Mode(_ccp_obj, CCP_MODULE_DISABLE);
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief The CCP1 interrupt MCAL helper function
+ * 
+ */
+void CCP1_ISR(void)
+{
+    #if CCP1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //CCP1 interrupt occurred, the flag must be cleared.
+    CCP1_INTERRUPT_FLAG_CLEAR();
+    //CallBack func gets called every time this ISR executes.
+    if(CCP1_InterruptHandler)
+    {
+        CCP1_InterruptHandler();
+    }else{/* Nothing */}
+    #endif
+}
+
+/**
+ * @brief The CCP2 interrupt MCAL helper function
+ * 
+ */
+void CCP2_ISR(void)
+{
+    #if CCP2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //CCP2 interrupt occurred, the flag must be cleared.
+    CCP2_INTERRUPT_FLAG_CLEAR();
+    //CallBack func gets called every time this ISR executes.
+    if(CCP2_InterruptHandler)
+    {
+        CCP2_InterruptHandler();
+    }else{/* Nothing */}
+    #endif
+}
+
+/**
+ * @brief Helper function to write the mode variant of the selected CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param ccp_mode_variant The CCPxM bits value.
+ */
+static inline void CCP_Set_Mode(const ccp_t *_ccp_obj, uint8 ccp_mode_variant)
+{
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCP1_SET_MODE(ccp_mode_variant);
+    }
+    else if(CCP2_INST == _ccp_obj->ccp_inst)
+    {
+        CCP2_SET_MODE(ccp_mode_variant);
+    }else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to configure the CCP interrupt.
+ *        The interrupt is only used by capture and compare modes, the PWM output needs no CPU.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ */
+static inline void CCP_Interrupt_Config(const ccp_t *_ccp_obj)
+{
+    if(CCP_PWM_MODE_SELECTED == _ccp_obj->ccp_mode)
+    {
+        return;
+    }
+#if CCP1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    if(CCP1_INST == _ccp_obj->ccp_inst)
+    {
+        CCP1_INTERRUPT_ENABLE();
+        CCP1_INTERRUPT_FLAG_CLEAR();
+        CCP1_InterruptHandler = _ccp_obj->CCP1_InterruptHandler;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP1_priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP1_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP1_priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP1_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+    }
+#endif
+#if CCP2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    if(CCP2_INST == _ccp_obj->ccp_inst)
+    {
+        CCP2_INTERRUPT_ENABLE();
+        CCP2_INTERRUPT_FLAG_CLEAR();
+        CCP2_InterruptHandler = _ccp_obj->CCP2_InterruptHandler;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == _ccp_obj->CCP2_priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            CCP2_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == _ccp_obj->CCP2_priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            CCP2_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+    }
+#endif
+}
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || \
+    (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/**
+ * @brief Helper function to select the timer of capture and compare modes.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ */
+static inline void CCP_Capture_Compare_Timer_Select(const ccp_t *_ccp_obj)
+{
+    if(CCP1_CCP2_TIMER3 == _ccp_obj->ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 0;
+        T3CONbits.T3CCP2 = 1;
+    }
+    else if(CCP1_TIMER1_CCP2_TIMER3 == _ccp_obj->ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 1;
+        T3CONbits.T3CCP2 = 0;
+    }
+    else if(CCP1_CCP2_TIMER1 == _ccp_obj->ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 0;
+        T3CONbits.T3CCP2 = 0;
+    }else{/* Nothing */}
+}
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/**
+ * @brief Helper function to write the PWM period in PR2.
+ *        PR2 = Fosc / (4 * Fpwm * Timer2 prescaler) - 1, it's shared by CCP1 and CCP2.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ */
+static inline void CCP_PWM_Period_Config(const ccp_t *_ccp_obj)
+{
+    //The prescaler values 0, 1 and 2 divide by 1, 4 and 16
+    uint32 l_prescaler = (uint32)1 << (2 * _ccp_obj->timer2_prescaler_value);
+    
+    if(ZERO_INIT != _ccp_obj->PWM_Frequency)
+    {
+        PR2 = (uint8)((_XTAL_FREQ / (4UL * _ccp_obj->PWM_Frequency * l_prescaler)) - 1);
+    }else{/* Nothing */}
+}
+#endif
@@ -0,0 +1,229 @@
+/* 
+ * File:   ccp.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:25 AM
+ */
+
+#ifndef CCP_H
+#define	CCP_H
+
+/* -------------- Includes -------------- */
+#include <pic18f4620.h>
+#include "../std_types.h"
+#include "../GPIO/gpio.h"
+#include "../TIMER2/timer2.h"
+#include "../interrupt/internal_interrupt.h"
+#include "ccp_cfg.h"
+
+/* -------------- Macro Declarations ------------- */
+//CCP module mode variants (CCPxM bits).
+#define CCP_MODULE_DISABLE                  ((uint8)0x00)
+#define CCP_CAPTURE_MODE_1_FALLING_EDGE     ((uint8)0x04)
+#define CCP_CAPTURE_MODE_1_RISING_EDGE      ((uint8)0x05)
+#define CCP_CAPTURE_MODE_4_RISING_EDGE      ((uint8)0x06)
+#define CCP_CAPTURE_MODE_16_RISING_EDGE     ((uint8)0x07)
+#define CCP_COMPARE_MODE_TOGGLE_ON_MATCH    ((uint8)0x02)
+#define CCP_COMPARE_MODE_SET_PIN_HIGH       ((uint8)0x08)
+#define CCP_COMPARE_MODE_SET_PIN_LOW        ((uint8)0x09)
+#define CCP_COMPARE_MODE_GEN_SW_INTERRUPT   ((uint8)0x0A)
+#define CCP_COMPARE_MODE_GEN_EVENT          ((uint8)0x0B)
+#define CCP_PWM_MODE                        ((uint8)0x0C)
+
+//CCP capture mode state.
+#define CCP_CAPTURE_NOT_READY               0x00
+#define CCP_CAPTURE_READY                   0x01
+
+//CCP compare mode state.
+#define CCP_COMPARE_NOT_READY               0x00
+#define CCP_COMPARE_READY                   0x01
+
+//PWM duty cycle limits in percent.
+#define CCP_PWM_DUTY_MIN                    ((uint8)0)
+#define CCP_PWM_DUTY_MAX                    ((uint8)100)
+
+/* -------------- Macro Functions Declarations --------------*/
+//Set the CCP module mode variant.
+#define CCP1_SET_MODE(_CONFIG)  (CCP1CONbits.CCP1M = _CONFIG)
+#define CCP2_SET_MODE(_CONFIG)  (CCP2CONbits.CCP2M = _CONFIG)
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief The CCP instance
+ * 
+ */
+typedef enum
+{
+    CCP1_INST = 0,
+    CCP2_INST
+}ccp_inst_t;
+
+/**
+ * @brief The main mode of the CCP module
+ * 
+ */
+typedef enum
+{
+    CCP_CAPTURE_MODE_SELECTED = 0,
+    CCP_COMPARE_MODE_SELECTED,
+    CCP_PWM_MODE_SELECTED
+}ccp_mode_t;
+
+/**
+ * @brief The timer used by capture and compare modes (T3CCP2:T3CCP1 bits)
+ * 
+ */
+typedef enum
+{
+    CCP1_CCP2_TIMER1 = 0,
+    CCP1_TIMER1_CCP2_TIMER3,
+    CCP1_CCP2_TIMER3
+}ccp_capture_timer_t;
+
+/**
+ * @brief The CCPRx register as two bytes or one 16-bit value
+ * 
+ */
+typedef union
+{
+    struct
+    {
+        uint8 ccpr_low;
+        uint8 ccpr_high;
+    };
+    struct
+    {
+        uint16 ccpr_16bit;
+    };
+}ccp_reg_t;
+
+typedef struct
+{
+    ccp_inst_t ccp_inst;                    // @ref ccp_inst_t
+    ccp_mode_t ccp_mode;                    // @ref ccp_mode_t
+    uint8 ccp_mode_variant;                 // CCPxM bits, @ref CCP_PWM_MODE and the capture/compare variants
+    pin_config_t ccp_pin;                   // The CCPx pin, output for compare and PWM, input for capture
+    ccp_capture_timer_t ccp_capture_timer;  // @ref ccp_capture_timer_t
+#if CCP1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    void (* CCP1_InterruptHandler)(void);
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority CCP1_priority;
+#endif
+#endif
+#if CCP2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    void (* CCP2_InterruptHandler)(void);
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority CCP2_priority;
+#endif
+#endif
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+    uint32 PWM_Frequency;                   // The PWM frequency in Hz, both modules share the Timer2 period
+    uint8 timer2_prescaler_value : 2;       // @ref timer2_prescaler_t, must match the Timer2 configuration
+    uint8 ccp_reserved : 6;
+#endif
+}ccp_t;
+
+/* -------------- Software Interfaces Declarations --------------*/
+/**
+ * @brief Initializes the CCP module based on the provided configuration.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Init(const ccp_t *_ccp_obj);
+
+/**
+ * @brief De-Initializes the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_DeInit(const ccp_t *_ccp_obj);
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_CAPTURE_MODE_SELECTED)
+/**
+ * @brief Checks if a new value has been captured.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _capture_status A pointer to store the status (@ref CCP_CAPTURE_READY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_IsCapturedDataReady(const ccp_t *_ccp_obj, uint8 *_capture_status);
+
+/**
+ * @brief Reads the captured 16-bit value.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param capture_value A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Capture_Mode_Read_Value(const ccp_t *_ccp_obj, uint16 *capture_value);
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_COMPARE_MODE_SELECTED)
+/**
+ * @brief Checks if the compare match has occurred.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _compare_status A pointer to store the status (@ref CCP_COMPARE_READY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_IsCompareComplete(const ccp_t *_ccp_obj, uint8 *_compare_status);
+
+/**
+ * @brief Writes the 16-bit compare value.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param compare_value The value to compare with the timer.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_Compare_Mode_Set_Value(const ccp_t *_ccp_obj, uint16 compare_value);
+#endif
+
+#if (CCP1_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED) || (CCP2_CFG_SELECTED_MODE==CCP_CFG_PWM_MODE_SELECTED)
+/**
+ * @brief Sets the PWM duty cycle, the hardware applies it at the start of the next period.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @param _duty The duty cycle in percent (0 .. 100).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Set_Duty(const ccp_t *_ccp_obj, const uint8 _duty);
+
+/**
+ * @brief Starts the PWM output of the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Start(const ccp_t *_ccp_obj);
+
+/**
+ * @brief Stops the PWM output of the CCP module.
+ * 
+ * @param _ccp_obj A pointer to the CCP configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType CCP_PWM_Stop(const ccp_t *_ccp_obj);
+#endif
+
+#endif	/* CCP_H */
+
@@ -0,0 +1,29 @@
+/* 
+ * File:   ccp_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:25 AM
+ */
+
+#ifndef CCP_CFG_H
+#define	CCP_CFG_H
+
+/* -------------- Includes -------------- */
+
+/* -------------- Macro Declarations ------------- */
+#define CCP_CFG_CAPTURE_MODE_SELECTED   0x00
+#define CCP_CFG_COMPARE_MODE_SELECTED   0x01
+#define CCP_CFG_PWM_MODE_SELECTED       0x02
+
+//Only the code of the selected modes is compiled
+#define CCP1_CFG_SELECTED_MODE          (CCP_CFG_PWM_MODE_SELECTED)
+#define CCP2_CFG_SELECTED_MODE          (CCP_CFG_COMPARE_MODE_SELECTED)
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+
+#endif	/* CCP_CFG_H */
+
@@ -0,0 +1,402 @@
+/* 
+ * File:   eeprom.c
+ * Author: Mohamed Sameh
+ *
+ * Created on September 21, 2023, 5:46 PM
+ */
+
+#include "eeprom.h"
+
+#define EEPROM_BYTE_NOT_QUEUED  (uint8)0
+#define EEPROM_BYTE_QUEUED      (uint8)1
+
+static void EEPROM_Start_Next(void);
+static inline void EEPROM_Start_Write(uint16 bAdd, uint8 bData);
+static inline uint8 EEPROM_Read_Memory(uint16 bAdd);
+static inline uint8 EEPROM_Lock_Queue(void);
+static inline void EEPROM_Unlock_Queue(uint8 interrupt_status);
+void EEPROM_ISR(void);
+
+/* Ring of the bytes waiting to be written, the oldest one (queue_tail) is the one being written.
+   The main code changes the queue with the EEPROM interrupt masked, the interrupt is its only other user */
+static uint16 queue_address[EEPROM_QUEUE_SIZE];
+static uint8 queue_data[EEPROM_QUEUE_SIZE];
+static void (*queue_callback[EEPROM_QUEUE_SIZE])(void);   // Set on the last byte of a request only
+static volatile uint8 queue_head = ZERO_INIT;
+static volatile uint8 queue_tail = ZERO_INIT;
+static volatile uint8 queue_count = ZERO_INIT;
+static volatile uint8 engine_status = EEPROM_IDLE;
+
+/**
+ * @brief Initializes the write engine and enables the EEPROM write complete interrupt.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Init(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    //Finish the writes of the blocking functions called before the init
+    ret = EEPROM_Flush();
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    EEPROM_INTERRUPT_FLAG_CLEAR();
+    EEPROM_INTERRUPT_ENABLE();
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    //A write takes about 4 ms, the next one can wait for the high priority interrupts
+    INTERRUPT_PriorityLevelsEnable();
+    INTERRUPT_GlobalInterruptLowEnable();
+    EEPROM_INT_LOW_PRIORITY();
+#else
+    INTERRUPT_GlobalInterruptEnable();
+    INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+    return ret;
+}
+
+/**
+ * @brief Queues a block of data to be written in the background.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData The data to be written, it's copied so it may change after the call.
+ * @param size The number of bytes (1 .. EEPROM_QUEUE_SIZE).
+ * @param callback Called from the EEPROM interrupt once the last byte is written, may be NULL.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The block is queued.
+ *         - E_NOT_OK: Wrong parameters or not enough free space in the queue, nothing is queued.
+ */
+Std_ReturnType EEPROM_WriteBlock_Async(uint16 bAdd, const uint8 *bData, const uint8 size, void (*callback)(void))
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_interrupt_status = ZERO_INIT;
+    uint8 l_counter = ZERO_INIT;
+
+    if(NULL == bData || ZERO_INIT == size || size > EEPROM_QUEUE_SIZE || ((uint32)bAdd + size) > EEPROM_SIZE)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_interrupt_status = EEPROM_Lock_Queue();
+        if(size > (uint8)(EEPROM_QUEUE_SIZE - queue_count))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            for(l_counter = ZERO_INIT; l_counter < size; l_counter++)
+            {
+                queue_address[queue_head] = bAdd + l_counter;
+                queue_data[queue_head] = bData[l_counter];
+                queue_callback[queue_head] = NULL;
+                if(l_counter == (uint8)(size - 1))
+                {
+                    queue_callback[queue_head] = callback;
+                }
+                queue_head = (uint8)((queue_head + 1) % EEPROM_QUEUE_SIZE);
+            }
+            queue_count += size;
+            //The engine stops when the queue runs empty, the first byte restarts it
+            if(EEPROM_IDLE == engine_status)
+            {
+                engine_status = EEPROM_BUSY;
+                EEPROM_Start_Next();
+            }
+        }
+        EEPROM_Unlock_Queue(l_interrupt_status);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads whether queued bytes are still being written.
+ *
+ * @param status A pointer to store the status (@ref EEPROM_IDLE, @ref EEPROM_BUSY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Get_Status(uint8 *status)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *status = engine_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Waits until all the queued bytes are written.
+ *        It serves the engine itself when the interrupts are disabled.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_Flush(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    while(EEPROM_BUSY == engine_status)
+    {
+        //Before the init, inside another handler or with the interrupts off nobody else serves EEIF
+        if((!INTCONbits.GIE || !INTCONbits.PEIE || !PIE2bits.EEIE) && PIR2bits.EEIF)
+        {
+            EEPROM_ISR();
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes one byte of data to a specific EEPROM Address and waits until it's written.
+ *
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_WriteByte(uint16 bAdd, uint8 bData)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = EEPROM_WriteBlock(bAdd, &bData, 1);
+    return ret;
+}
+
+/**
+ * @brief Writes a block of data and waits until it's written.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData The data to be written.
+ * @param size The number of bytes (1 .. EEPROM_QUEUE_SIZE).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_WriteBlock(uint16 bAdd, const uint8 *bData, const uint8 size)
+{
+    Std_ReturnType ret = E_OK;
+
+    //A full queue is emptied first, so only wrong parameters can fail the second try
+    ret = EEPROM_WriteBlock_Async(bAdd, bData, size, NULL);
+    if(E_OK != ret)
+    {
+        EEPROM_Flush();
+        ret = EEPROM_WriteBlock_Async(bAdd, bData, size, NULL);
+    }
+    if(E_OK == ret)
+    {
+        ret = EEPROM_Flush();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads one byte of data from a specific EEPROM Address.
+ *
+ * @param bAdd The EEPROM address to read from..
+ * @param bData A pointer to store the read data.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_ReadByte(uint16 bAdd, uint8 *bData)
+{
+    Std_ReturnType ret = E_OK;
+
+    ret = EEPROM_ReadBlock(bAdd, bData, 1);
+    return ret;
+}
+
+/**
+ * @brief Reads a block of data.
+ *
+ * @param bAdd The EEPROM address of the first byte.
+ * @param bData A pointer to store the read data.
+ * @param size The number of bytes.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EEPROM_ReadBlock(uint16 bAdd, uint8 *bData, const uint8 size)
+{
+    Std_ReturnType ret = E_OK;
+    /* Bytes read counter */
+    uint16 counter = ZERO_INIT;
+    uint8 l_interrupt_status = ZERO_INIT;
+    uint8 l_index = ZERO_INIT, l_pending = ZERO_INIT, l_found = EEPROM_BYTE_NOT_QUEUED;
+
+    if(NULL == bData)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The interrupt must not start the next byte while EEADR is used for the read
+        l_interrupt_status = EEPROM_Lock_Queue();
+        while (counter < size)
+        {
+            //A queued byte is newer than the memory, the last queued one wins
+            l_found = EEPROM_BYTE_NOT_QUEUED;
+            l_index = queue_tail;
+            for(l_pending = ZERO_INIT; l_pending < queue_count; l_pending++)
+            {
+                if(queue_address[l_index] == bAdd)
+                {
+                    *bData = queue_data[l_index];
+                    l_found = EEPROM_BYTE_QUEUED;
+                }
+                l_index = (uint8)((l_index + 1) % EEPROM_QUEUE_SIZE);
+            }
+            if(EEPROM_BYTE_NOT_QUEUED == l_found)
+            {
+                //EEADR can't change during a write cycle
+                while(EECON1bits.WR){}
+                *bData = EEPROM_Read_Memory(bAdd);
+            }
+            bAdd++;
+            bData++;
+            counter++;
+        }
+        EEPROM_Unlock_Queue(l_interrupt_status);
+    }
+    return ret;
+}
+
+/**
+ * @brief The EEPROM write complete interrupt MCAL helper function.
+ *        The byte at the tail is written, it's dropped and the next one is started.
+ */
+void EEPROM_ISR(void)
+{
+    void (*l_callback)(void) = NULL;
+
+    PIR2bits.EEIF = 0;
+    //Inhibits write cycles to Flash program/data EEPROM
+    EECON1bits.WREN = INHIBITS_WRITE_CYCLES;
+    if(EEPROM_IDLE == engine_status)
+    {
+        return;
+    }
+    l_callback = queue_callback[queue_tail];
+    queue_tail = (uint8)((queue_tail + 1) % EEPROM_QUEUE_SIZE);
+    queue_count--;
+    EEPROM_Start_Next();
+    //The next byte is already running, the callback may queue more
+    if(l_callback)
+    {
+        l_callback();
+    }else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to start the write cycle of the byte at the tail of the queue.
+ *        Bytes the memory already holds are dropped without a write cycle, except the last byte
+ *        of a request with a callback: its write complete interrupt runs the callback.
+ *        It's called with the queue locked or from the interrupt, and never during a write cycle.
+ */
+static void EEPROM_Start_Next(void)
+{
+    while((ZERO_INIT != queue_count) && (NULL == queue_callback[queue_tail]) &&
+          (EEPROM_Read_Memory(queue_address[queue_tail]) == queue_data[queue_tail]))
+    {
+        queue_tail = (uint8)((queue_tail + 1) % EEPROM_QUEUE_SIZE);
+        queue_count--;
+    }
+    if(ZERO_INIT == queue_count)
+    {
+        engine_status = EEPROM_IDLE;
+    }
+    else
+    {
+        EEPROM_Start_Write(queue_address[queue_tail], queue_data[queue_tail]);
+    }
+}
+
+/**
+ * @brief Helper function to start the write cycle of one byte.
+ *        The interrupts are disabled only around the unlock sequence, which must not be split.
+ *
+ * @param bAdd The EEPROM address to write at.
+ * @param bData Data to be written.
+ */
+static inline void EEPROM_Start_Write(uint16 bAdd, uint8 bData)
+{
+    //Reads the Interrupt Status "enabled or disabled", GIE is GIEH with the priority levels
+    uint8 Global_Interrupt_Status = INTCONbits.GIE;
+
+    //Updates the Data Memory Address to write at
+    EEADRH = (uint8)((bAdd >> 8) & 0x03);
+    EEADR = (uint8)(bAdd & 0xFF);
+    //Data Memory Value to write
+    EEDATA = bData;
+    //Access EEPROM
+    EECON1bits.EEPGD = ACCESS_EEPROM_MEMORY;
+    EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
+    //Allows write cycles to Flash program/data EEPROM
+    EECON1bits.WREN = ALLOW_WRITE_CYCLES;
+    //Disable all interrupts for the unlock sequence only
+    INTERRUPT_GlobalInterruptDisable();
+    //Write the required seq
+    EECON2 = 0x55;
+    EECON2 = 0xAA;
+    //Initiates a data EEPROM erase/write cycle, EEIF is set when it's completed
+    EECON1bits.WR = INITIATE_EEPROM_DATA_WRITE_ERASE;
+    //Restores the Interrupt Status "enabled or disabled"
+    INTCONbits.GIE = Global_Interrupt_Status;
+}
+
+/**
+ * @brief Helper function to read one byte of the memory, no write cycle may be running.
+ *
+ * @param bAdd The EEPROM address to read from.
+ * @return The byte stored at the address.
+ */
+static inline uint8 EEPROM_Read_Memory(uint16 bAdd)
+{
+    //Updates the Data Memory Address to read
+    EEADRH = (uint8)((bAdd >> 8) & 0x03);
+    EEADR = (uint8)(bAdd & 0xFF);
+    //Access EEPROM
+    EECON1bits.EEPGD = ACCESS_EEPROM_MEMORY;
+    EECON1bits.CFGS = ACCESS_FLASH_EEPROM_MEMORY;
+    //Initiates an EEPROM read
+    EECON1bits.RD = INITIATE_EEPROM_DATA_READ;
+    NOP();
+    NOP();
+    //Reads data
+    return EEDATA;
+}
+
+/**
+ * @brief Helper function to mask the EEPROM interrupt while the main code uses the queue.
+ *
+ * @return The EEPROM interrupt enable bit before the call.
+ */
+static inline uint8 EEPROM_Lock_Queue(void)
+{
+    uint8 l_interrupt_status = PIE2bits.EEIE;
+
+    PIE2bits.EEIE = 0;
+    return l_interrupt_status;
+}
+
+/**
+ * @brief Helper function to restore the EEPROM interrupt after the queue is used.
+ *
+ * @param interrupt_status The EEPROM interrupt enable bit returned by EEPROM_Lock_Queue().
+ */
+static inline void EEPROM_Unlock_Queue(uint8 interrupt_status)
+{
+    PIE2bits.EEIE = interrupt_status;
+}
@@ -0,0 +1,311 @@
+/* 
+ * File:   eusart.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:40 PM
+ */
+
+#include "eusart.h"
+
+void EUSART_TX_ISR(void);
+void EUSART_RX_ISR(void);
+
+/* The indexes run free over 0 .. 255 and are masked on use, head - tail is the number of bytes.
+   Each index has a single writer: the main code moves tx_head and rx_tail, the interrupts tx_tail and rx_head.
+   EUSART_Write_Async() and EUSART_Read() are for the main code only */
+static uint8 tx_buffer[EUSART_TX_BUFFER_SIZE];
+static uint8 rx_buffer[EUSART_RX_BUFFER_SIZE];
+static volatile uint8 tx_head = ZERO_INIT;
+static volatile uint8 tx_tail = ZERO_INIT;
+static volatile uint8 rx_head = ZERO_INIT;
+static volatile uint8 rx_tail = ZERO_INIT;
+static volatile uint8 rx_errors = EUSART_RX_NO_ERROR;
+
+/**
+ * @brief Initializes the EUSART in asynchronous mode at EUSART_BAUD_RATE and enables the RX interrupt.
+ *        The TX interrupt is enabled only while there are bytes to send.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Init(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    //Disable the module while it's configured
+    EUSART_TX_INTERRUPT_DISABLE();
+    EUSART_RX_INTERRUPT_DISABLE();
+    RCSTAbits.SPEN = 0;
+    TXSTAbits.TXEN = 0;
+    RCSTAbits.CREN = 0;
+    tx_head = ZERO_INIT;
+    tx_tail = ZERO_INIT;
+    rx_head = ZERO_INIT;
+    rx_tail = ZERO_INIT;
+    rx_errors = EUSART_RX_NO_ERROR;
+    //Both pins are inputs, the module takes RC6 over as the TX output
+    TRISCbits.RC6 = 1;
+    TRISCbits.RC7 = 1;
+    //Asynchronous 8-bit, 16-bit baud rate generator in high speed: Fosc / (4 * (SPBRGH:SPBRG + 1))
+    TXSTAbits.SYNC = 0;
+    TXSTAbits.TX9 = 0;
+    RCSTAbits.RX9 = 0;
+    TXSTAbits.BRGH = 1;
+    BAUDCONbits.BRG16 = 1;
+    SPBRGH = (uint8)((EUSART_BRG_VALUE >> 8) & 0xFF);
+    SPBRG = (uint8)(EUSART_BRG_VALUE & 0xFF);
+    RCSTAbits.SPEN = 1;
+    TXSTAbits.TXEN = 1;
+    RCSTAbits.CREN = 1;
+    //Drop the bytes received before the init
+    while(PIR1bits.RCIF)
+    {
+        (void)RCREG;
+    }
+    EUSART_RX_INTERRUPT_ENABLE();
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    //A late RX interrupt loses bytes, a late TX one only slows the line down
+    INTERRUPT_PriorityLevelsEnable();
+    INTERRUPT_GlobalInterruptHighEnable();
+    INTERRUPT_GlobalInterruptLowEnable();
+    EUSART_RX_INT_HIGH_PRIORITY();
+    EUSART_TX_INT_LOW_PRIORITY();
+#else
+    INTERRUPT_GlobalInterruptEnable();
+    INTERRUPT_PeripheralInterruptEnable();
+#endif
+    return ret;
+}
+
+/**
+ * @brief Queues bytes to be sent in the background, it never waits.
+ *
+ * @param data The bytes to be sent, they're copied so they may change after the call.
+ * @param size The number of bytes (1 .. EUSART_TX_BUFFER_SIZE).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The bytes are queued.
+ *         - E_NOT_OK: Wrong parameters or not enough free space in the buffer, nothing is queued.
+ */
+Std_ReturnType EUSART_Write_Async(const uint8 *data, const uint8 size)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_head = tx_head;
+    uint8 l_counter = ZERO_INIT;
+
+    if((NULL == data) || (ZERO_INIT == size) || (size > EUSART_TX_BUFFER_SIZE))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(size > (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(l_head - tx_tail)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_counter = ZERO_INIT; l_counter < size; l_counter++)
+        {
+            tx_buffer[l_head & EUSART_TX_BUFFER_MASK] = data[l_counter];
+            l_head++;
+        }
+        //The bytes are in the buffer before the interrupt can see them
+        tx_head = l_head;
+        EUSART_TX_INTERRUPT_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the free space of the TX buffer.
+ *
+ * @param free_size A pointer to store the number of bytes that can be queued.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Tx_Free(uint8 *free_size)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == free_size)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *free_size = (uint8)(EUSART_TX_BUFFER_SIZE - (uint8)(tx_head - tx_tail));
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads whether queued bytes are still being sent.
+ *
+ * @param status A pointer to store the status (@ref EUSART_TX_IDLE, @ref EUSART_TX_BUSY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Status(uint8 *status)
+{
+    Std_ReturnType ret = E_OK;
+
+    if(NULL == status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //TRMT is clear while the last byte is still shifting out
+        *status = ((tx_head != tx_tail) || !TXSTAbits.TRMT) ? EUSART_TX_BUSY : EUSART_TX_IDLE;
+    }
+    return ret;
+}
+
+/**
+ * @brief Waits until all the queued bytes are sent, the last one included.
+ *        It serves the transmitter itself when the interrupts are disabled.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Flush(void)
+{
+    Std_ReturnType ret = E_OK;
+
+    while((tx_head != tx_tail) || !TXSTAbits.TRMT)
+    {
+        //Before the init, inside another handler or with the interrupts off nobody else serves TXIF
+        if((!INTCONbits.GIE || !INTCONbits.PEIE || !PIE1bits.TXIE) && PIR1bits.TXIF && (tx_head != tx_tail))
+        {
+            EUSART_TX_ISR();
+        }else{/* Nothing */}
+    }
+    return ret;
+}
+
+/**
+ * @brief Takes the oldest received byte out of the RX buffer, it never waits.
+ *
+ * @param data A pointer to store the byte.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A byte is read.
+ *         - E_NOT_OK: Wrong parameters or no byte received.
+ */
+Std_ReturnType EUSART_Read(uint8 *data)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tail = rx_tail;
+
+    if(NULL == data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //With the interrupts off the FIFO is drained here
+        if((!INTCONbits.GIE || !INTCONbits.PEIE || !PIE1bits.RCIE) && PIR1bits.RCIF)
+        {
+            EUSART_RX_ISR();
+        }else{/* Nothing */}
+        if(rx_head == l_tail)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            *data = rx_buffer[l_tail & EUSART_RX_BUFFER_MASK];
+            //The slot is free for the interrupt once the byte is copied
+            rx_tail = (uint8)(l_tail + 1);
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the receive errors since the last call and clears them.
+ *
+ * @param errors A pointer to store the errors (@ref EUSART_RX_FRAMING_ERROR, @ref EUSART_RX_OVERRUN_ERROR,
+ *               @ref EUSART_RX_BUFFER_FULL), EUSART_RX_NO_ERROR if none.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Rx_Errors(uint8 *errors)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_interrupt_status = ZERO_INIT;
+
+    if(NULL == errors)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //The read and the clear must not be split by the RX interrupt
+        l_interrupt_status = PIE1bits.RCIE;
+        EUSART_RX_INTERRUPT_DISABLE();
+        *errors = rx_errors;
+        rx_errors = EUSART_RX_NO_ERROR;
+        PIE1bits.RCIE = l_interrupt_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief The EUSART transmit interrupt MCAL helper function.
+ *        TXREG is empty: the next byte is loaded, or the interrupt is masked when the buffer is empty
+ *        (TXIF can't be cleared, it stays set as long as TXREG is empty).
+ */
+void EUSART_TX_ISR(void)
+{
+    uint8 l_tail = tx_tail;
+
+    if(tx_head == l_tail)
+    {
+        EUSART_TX_INTERRUPT_DISABLE();
+    }
+    else
+    {
+        TXREG = tx_buffer[l_tail & EUSART_TX_BUFFER_MASK];
+        tx_tail = (uint8)(l_tail + 1);
+    }
+}
+
+/**
+ * @brief The EUSART receive interrupt MCAL helper function.
+ *        The whole FIFO is drained in one call, a late interrupt costs one context save for 2 bytes.
+ */
+void EUSART_RX_ISR(void)
+{
+    uint8 l_head = rx_head;
+    uint8 l_data = ZERO_INIT;
+
+    while(PIR1bits.RCIF)
+    {
+        //FERR belongs to the byte on top of the FIFO, it's read before RCREG moves on
+        if(RCSTAbits.FERR)
+        {
+            rx_errors |= EUSART_RX_FRAMING_ERROR;
+        }else{/* Nothing */}
+        l_data = RCREG;
+        if((uint8)(l_head - rx_tail) < EUSART_RX_BUFFER_SIZE)
+        {
+            rx_buffer[l_head & EUSART_RX_BUFFER_MASK] = l_data;
+            l_head++;
+        }
+        else
+        {
+            rx_errors |= EUSART_RX_BUFFER_FULL;
+        }
+    }
+    rx_head = l_head;
+    if(RCSTAbits.OERR)
+    {
+        //The receiver stops on an overrun until CREN is cleared
+        rx_errors |= EUSART_RX_OVERRUN_ERROR;
+        RCSTAbits.CREN = 0;
+        RCSTAbits.CREN = 1;
+    }else{/* Nothing */}
+}
@@ -0,0 +1,152 @@
+/* 
+ * File:   eusart.h
+ * Author: Mohamed Sameh
+ * Description:
+ * EUSART driver, asynchronous 8N1 on RC6 (TX) / RC7 (RX). Both directions go through a ring buffer
+ * served by the EUSART interrupts: EUSART_Write_Async() copies the bytes and returns at once, the TX
+ * interrupt (TXIF) loads TXREG one byte at a time and masks itself when the buffer runs empty. The RX
+ * interrupt (RCIF) drains the 2-byte hardware FIFO into the RX buffer, EUSART_Read() takes them out.
+ * The main code only moves the head of the TX buffer and the tail of the RX buffer, the interrupts only
+ * the other end, so neither side masks the interrupts to use the buffers.
+ * The divider is computed at build time from _XTAL_FREQ and EUSART_BAUD_RATE with the 16-bit
+ * generator in high speed (SPBRGH:SPBRG = Fosc / (4 * baud) - 1), a rate off by more than
+ * EUSART_BAUD_ERROR_MAX is refused by an #error.
+ *
+ * Throughput and interrupt cost, one interrupt per byte and per direction. A byte is 10 bits on the
+ * line, an instruction cycle is 1 us at 4 MHz (master) and 0.5 us at 8 MHz (slave). The interrupt is
+ * estimated at about 90 instruction cycles per byte: about 40 for the entry, the context save/restore
+ * and RETFIE, about 30 for the checks of the interrupt manager and 15 .. 25 for the handler.
+ *   baud     byte time  max bytes/s  64 bytes  | 4 MHz: error  CPU load | 8 MHz: error  CPU load
+ *   9600     1042 us      960        67 ms     |       +0.16%   9 %     |       +0.16%   4 %
+ *   19200     521 us     1920        33 ms     |       +0.16%  17 %     |       +0.16%   9 %
+ *   38400     260 us     3840        17 ms     |       +0.16%  35 %     |       +0.16%  17 %
+ *   57600     174 us     5760        11 ms     |       +2.12%  52 %     |       -0.79%  26 %
+ *   115200     87 us    11520         6 ms     |       -3.55%  n/a      |       +2.12%  52 %
+ * The load is for a direction running flat out, a burst costs it only while it's being sent.
+ * 115200 isn't usable at 4 MHz: the rate is refused and a byte would need more cycles than it lasts.
+ * A received byte must be read within 2 byte times (the FIFO holds 2 bytes plus the one shifting in),
+ * so no other interrupt handler may run longer than that, about 1 ms at 19200.
+ *
+ * Created on October 19, 2026, 9:40 PM
+ */
+
+#ifndef EUSART_H
+#define	EUSART_H
+/* -------------- Includes -------------- */
+#include <pic18f4620.h>
+#include "eusart_cfg.h"
+#include "../std_types.h"
+#include "../device_config.h"
+#include "../interrupt/internal_interrupt.h"
+
+/* -------------- Macro Declarations ------------- */
+#define EUSART_TX_BUFFER_MASK       (EUSART_TX_BUFFER_SIZE - 1U)
+#define EUSART_RX_BUFFER_MASK       (EUSART_RX_BUFFER_SIZE - 1U)
+
+//Value of SPBRGH:SPBRG, rounded to the nearest rate, and the rate it gives
+#define EUSART_BRG_VALUE            (((_XTAL_FREQ + (2UL * EUSART_BAUD_RATE)) / (4UL * EUSART_BAUD_RATE)) - 1UL)
+#define EUSART_ACTUAL_BAUD_RATE     (_XTAL_FREQ / (4UL * (EUSART_BRG_VALUE + 1UL)))
+
+//Receive errors, sticky until EUSART_Get_Rx_Errors() reads them.
+#define EUSART_RX_NO_ERROR          0x00
+#define EUSART_RX_FRAMING_ERROR     0x01    // A stop bit read as 0, the byte is kept
+#define EUSART_RX_OVERRUN_ERROR     0x02    // The hardware FIFO overflowed, bytes were lost
+#define EUSART_RX_BUFFER_FULL       0x04    // The RX buffer was full, bytes were dropped
+
+//Transmitter status.
+#define EUSART_TX_IDLE              0x00
+#define EUSART_TX_BUSY              0x01
+
+#if (EUSART_TX_BUFFER_SIZE < 2U) || (EUSART_TX_BUFFER_SIZE > 128U) || (EUSART_TX_BUFFER_SIZE & EUSART_TX_BUFFER_MASK)
+#error "eusart: the TX buffer size is a power of two, 2 .. 128"
+#endif
+#if (EUSART_RX_BUFFER_SIZE < 2U) || (EUSART_RX_BUFFER_SIZE > 128U) || (EUSART_RX_BUFFER_SIZE & EUSART_RX_BUFFER_MASK)
+#error "eusart: the RX buffer size is a power of two, 2 .. 128"
+#endif
+#if (EUSART_BRG_VALUE < 1UL) || (EUSART_BRG_VALUE > 65535UL)
+#error "eusart: the baud rate is out of range for _XTAL_FREQ"
+#endif
+#if ((EUSART_ACTUAL_BAUD_RATE > EUSART_BAUD_RATE) && \
+     (((EUSART_ACTUAL_BAUD_RATE - EUSART_BAUD_RATE) * 1000UL) > (EUSART_BAUD_ERROR_MAX * EUSART_BAUD_RATE))) || \
+    ((EUSART_ACTUAL_BAUD_RATE < EUSART_BAUD_RATE) && \
+     (((EUSART_BAUD_RATE - EUSART_ACTUAL_BAUD_RATE) * 1000UL) > (EUSART_BAUD_ERROR_MAX * EUSART_BAUD_RATE)))
+#error "eusart: the baud rate error is over EUSART_BAUD_ERROR_MAX at this _XTAL_FREQ"
+#endif
+
+/* -------------- Macro Functions Declarations --------------*/
+
+/* -------------- Data Types Declarations --------------  */
+
+/* -------------- Functions Declarations --------------*/
+/**
+ * @brief Initializes the EUSART in asynchronous mode at EUSART_BAUD_RATE and enables the RX interrupt.
+ *        The TX interrupt is enabled only while there are bytes to send.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Init(void);
+
+/**
+ * @brief Queues bytes to be sent in the background, it never waits.
+ *
+ * @param data The bytes to be sent, they're copied so they may change after the call.
+ * @param size The number of bytes (1 .. EUSART_TX_BUFFER_SIZE).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The bytes are queued.
+ *         - E_NOT_OK: Wrong parameters or not enough free space in the buffer, nothing is queued.
+ */
+Std_ReturnType EUSART_Write_Async(const uint8 *data, const uint8 size);
+
+/**
+ * @brief Reads the free space of the TX buffer.
+ *
+ * @param free_size A pointer to store the number of bytes that can be queued.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Tx_Free(uint8 *free_size);
+
+/**
+ * @brief Reads whether queued bytes are still being sent.
+ *
+ * @param status A pointer to store the status (@ref EUSART_TX_IDLE, @ref EUSART_TX_BUSY).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Status(uint8 *status);
+
+/**
+ * @brief Waits until all the queued bytes are sent, the last one included.
+ *        It serves the transmitter itself when the interrupts are disabled.
+ *
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Flush(void);
+
+/**
+ * @brief Takes the oldest received byte out of the RX buffer, it never waits.
+ *
+ * @param data A pointer to store the byte.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: A byte is read.
+ *         - E_NOT_OK: Wrong parameters or no byte received.
+ */
+Std_ReturnType EUSART_Read(uint8 *data);
+
+/**
+ * @brief Reads the receive errors since the last call and clears them.
+ *
+ * @param errors A pointer to store the errors (@ref EUSART_RX_FRAMING_ERROR, @ref EUSART_RX_OVERRUN_ERROR,
+ *               @ref EUSART_RX_BUFFER_FULL), EUSART_RX_NO_ERROR if none.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType EUSART_Get_Rx_Errors(uint8 *errors);
+#endif	/* EUSART_H */
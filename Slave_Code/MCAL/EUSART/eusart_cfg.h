@@ -0,0 +1,31 @@
+/* 
+ * File:   eusart_cfg.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 9:40 PM
+ */
+
+#ifndef EUSART_CFG_H
+#define	EUSART_CFG_H
+/* -------------- Includes -------------- */
+
+
+/* -------------- Macro Declarations ------------- */
+//Bits per second, the divider is computed from _XTAL_FREQ (see eusart.h for the usable rates)
+#define EUSART_BAUD_RATE            19200UL
+//Largest baud rate error accepted, in 1/1000
+#define EUSART_BAUD_ERROR_MAX       25UL
+
+//Bytes waiting to be sent / read, powers of two up to 128
+#define EUSART_TX_BUFFER_SIZE       64U
+#define EUSART_RX_BUFFER_SIZE       16U
+
+/* -------------- Macro Functions Declarations -------------- */
+
+
+/* -------------- Data Types Declarations ---------------------- */
+
+
+/* -------------- Software Interfaces Declarations -------------- */
+
+#endif	/* EUSART_CFG_H */
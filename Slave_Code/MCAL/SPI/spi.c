@@ -137,6 +137,61 @@ uint8 SPI_Transfer_data(uint8 data)
     return SSPBUF;
 }
 
+/**
+ * @brief Loads the data to be shifted out at the next transfer without waiting for it.
+ * 
+ * @param data Data to be transmitted.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A write collision occurred (a transfer is in progress).
+ */
+Std_ReturnType SPI_Write_Data_Nonblocking(const uint8 data)
+{
+    Std_ReturnType ret = E_OK;
+    
+    SPI_TRANSMIT_COLLISION_CLEAR();
+    SSPBUF = data;
+    if(SPI_WRITE_COLLISION_OCCURRED == SPI_TRANSMIT_COLLISION_CHECK())
+    {
+        SPI_TRANSMIT_COLLISION_CLEAR();
+        ret = E_NOT_OK;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads the received data if a transfer has been completed, without waiting for it.
+ * 
+ * @param rec_data A pointer to store the received data.
+ * @param rec_status A pointer to store the status (@ref SPI_DATA_RECEIVED or SPI_DATA_NOT_RECEIVED).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Read_Data_Nonblocking(uint8 *rec_data, uint8 *rec_status)
+{
+    Std_ReturnType ret = E_OK;
+    
+    if(NULL == rec_data || NULL == rec_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(SPI_RECEIVE_STATUS())
+        {
+            //Reading the buffer clears the buffer full flag
+            *rec_data = SSPBUF;
+            *rec_status = SPI_DATA_RECEIVED;
+        }
+        else
+        {
+            *rec_status = SPI_DATA_NOT_RECEIVED;
+        }
+    }
+    return ret;
+}
+
 /**
  * @brief A master trasmit and receive data from a slave.
  * 
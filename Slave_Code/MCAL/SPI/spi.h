@@ -28,6 +28,9 @@
 
 #define SPI_WRITE_COLLISION_OCCURRED        1  
 #define SPI_WRITE_COLLISION_UNOCCURRED      0  
+
+#define SPI_DATA_RECEIVED                   1
+#define SPI_DATA_NOT_RECEIVED               0
 /* -------------- Macro Functions Declarations -------------- */
 //SPI Enable or Disable.
 #define SPI_ENABLE()     (SSPCON1bits.SSPEN = 1)
@@ -137,6 +140,27 @@ Std_ReturnType SPI_Slave_Init(const spi_t *_spi);
  */
 uint8 SPI_Transfer_data(uint8 data);
 
+/**
+ * @brief Loads the data to be shifted out at the next transfer without waiting for it.
+ * 
+ * @param data Data to be transmitted.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: A write collision occurred (a transfer is in progress).
+ */
+Std_ReturnType SPI_Write_Data_Nonblocking(const uint8 data);
+
+/**
+ * @brief Reads the received data if a transfer has been completed, without waiting for it.
+ * 
+ * @param rec_data A pointer to store the received data.
+ * @param rec_status A pointer to store the status (@ref SPI_DATA_RECEIVED or SPI_DATA_NOT_RECEIVED).
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType SPI_Read_Data_Nonblocking(uint8 *rec_data, uint8 *rec_status);
+
 /**
  * @brief A master transmits and receives data from a slave.
  * 
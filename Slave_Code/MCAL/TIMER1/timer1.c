@@ -0,0 +1,232 @@
+/* 
+ * File:   timer1.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 2:40 PM
+ */
+
+#include "timer1.h"
+
+#if TIMER1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void (*TMR1_InterruptHandler)(void) = NULL;
+#endif
+
+static inline void Timer1_Mode_Select(const timer1_t *timer1);
+static inline void Timer1_RW_Reg_Mode_Select(const timer1_t *timer1);
+
+static uint16 preload = ZERO_INIT;
+
+/**
+ * @brief Initializes Timer1 based on the provided configuration.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Init(const timer1_t *timer1)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer1)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable the Timer1 Module
+        TIMER1_MODULE_DISABLE();
+        //Configure the Prescaler
+        TIMER1_PRESCALER_SELECT(timer1->timer1_prescaler_value);
+        //Select the Timer1 Mode
+        Timer1_Mode_Select(timer1);
+        //Select the read/write register mode (8bits or 16bits)
+        Timer1_RW_Reg_Mode_Select(timer1);
+        //Enable the Timer1 oscillator only for an external crystal
+        if(TIMER1_OSCILLATOR_ENABLE == timer1->timer1_osc_cfg)
+        {
+            TIMER1_OSC_HW_ENABLE();
+        }
+        else
+        {
+            TIMER1_OSC_HW_DISABLE();
+        }
+        //Write preload value if there is.
+        TMR1H = (timer1->timer1_preload >> 8);
+        TMR1L = (uint8) (timer1->timer1_preload);
+        //Store the preload value 
+        preload = timer1->timer1_preload;
+
+        //Configure the interrupt
+#if TIMER1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        TIMER1_INTERRUPT_ENABLE();
+        TIMER1_INTERRUPT_FLAG_CLEAR();
+        TMR1_InterruptHandler = timer1->TMR1_InterruptHandler;
+        //Interrupt priority configurations
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == timer1->priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            TIMER1_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == timer1->priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            TIMER1_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else 
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+        //Enable the Timer1 Module
+        TIMER1_MODULE_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief De-Initializes the Timer1 Module.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_DeInit(const timer1_t *timer1)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer1)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable Timer1 Module
+        TIMER1_MODULE_DISABLE();
+        //Disable Timer1 Interrupt
+#if TIMER1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        TIMER1_INTERRUPT_DISABLE();
+#endif
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes a 16-bit value to Timer1. 
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @param val The 16-bit value to write to Timer1.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Write_Value(const timer1_t *timer1, uint16 val)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer1)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        TMR1H = (uint8)(val >> 8);
+        TMR1L = (uint8) (val);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a 16-bit value from Timer1.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @param val A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Read(const timer1_t *timer1, uint16 *val)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tmr1l = ZERO_INIT, l_tmr1h = ZERO_INIT;
+
+    if (NULL == timer1 || NULL == val)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //TMR1L must be read first, in 16-bit mode it latches TMR1H
+        l_tmr1l = TMR1L;
+        l_tmr1h = TMR1H;
+        *val = (uint16) ((l_tmr1h << 8) + l_tmr1l);
+    }
+    return ret;
+} 
+
+/**
+ * @brief The Timer1 interrupt MCAL helper function
+ * 
+ */
+void TMR1_ISR(void)
+{
+    #if TIMER1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //Timer1 interrupt occurred, the flag must be cleared.
+    TIMER1_INTERRUPT_FLAG_CLEAR();
+    //Write the preload value every time this ISR executes.
+    TMR1H = (uint8)(preload >> 8);
+    TMR1L = (uint8) (preload);
+    //CallBack func gets called every time this ISR executes.
+    if(TMR1_InterruptHandler)
+    {
+        TMR1_InterruptHandler();
+    }else{/* Nothing */}
+    #endif
+}
+
+/**
+ * @brief Helper function to select the mode (Timer or Counter).
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ */
+static inline void Timer1_Mode_Select(const timer1_t *timer1)
+{
+    if(TIMER1_TIMER_MODE == timer1->timer1_mode)
+    {
+        TIMER1_TIMER_MODE_ENABLE();
+    }
+    else if(TIMER1_COUNTER_MODE == timer1->timer1_mode)
+    {
+        TIMER1_COUNTER_MODE_ENABLE();
+        if(TIMER1_ASYNC_COUNTER_MODE == timer1->timer1_counter_mode)
+        {
+            TIMER1_ASYNC_COUNTER_MODE_ENABLE();
+        }
+        else if(TIMER1_SYNC_COUNTER_MODE == timer1->timer1_counter_mode)
+        {
+            TIMER1_SYNC_COUNTER_MODE_ENABLE();
+        }
+        else{/* Nothing */}
+    }
+    else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to configure the read/write register mode (8-bits or 16-bits). 
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ */
+static inline void Timer1_RW_Reg_Mode_Select(const timer1_t *timer1)
+{
+    if(TIMER1_RW_REG_16BIT_MODE == timer1->timer1_reg_wr_mode)
+    {
+        TIMER1_RW_REG_16BIT_MODE_ENABLE();
+    }
+    else if(TIMER1_RW_REG_8BIT_MODE == timer1->timer1_reg_wr_mode)
+    {
+        TIMER1_RW_REG_8BIT_MODE_ENABLE();
+    }else{/* Nothing */}
+}
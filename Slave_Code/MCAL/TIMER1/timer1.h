@@ -0,0 +1,132 @@
+/* 
+ * File:   timer1.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 2:40 PM
+ */
+
+#ifndef TIMER1_H
+#define	TIMER1_H
+
+/* -------------- Includes -------------- */
+#include <pic18f4620.h>
+#include "../std_types.h"
+#include "../interrupt/internal_interrupt.h"
+
+/* -------------- Macro Declarations ------------- */
+//Timer1 mode selection.
+#define TIMER1_TIMER_MODE        0
+#define TIMER1_COUNTER_MODE      1
+
+//Timer1 external clock input synchronization (Counter mode).
+#define TIMER1_ASYNC_COUNTER_MODE     1
+#define TIMER1_SYNC_COUNTER_MODE      0
+
+//Timer1 read/write register mode selection.
+#define TIMER1_RW_REG_8BIT_MODE       0
+#define TIMER1_RW_REG_16BIT_MODE      1
+
+//Timer1 oscillator (T1OSO/T1OSI crystal) selection.
+#define TIMER1_OSCILLATOR_ENABLE      1
+#define TIMER1_OSCILLATOR_DISABLE     0
+
+/* -------------- Macro Functions Declarations --------------*/
+//This macro enables timer1.
+#define TIMER1_MODULE_ENABLE()   (T1CONbits.TMR1ON = 1)
+//This macro disables timer1.
+#define TIMER1_MODULE_DISABLE()  (T1CONbits.TMR1ON = 0)
+
+//Timer1 mode selection.
+#define TIMER1_TIMER_MODE_ENABLE()     (T1CONbits.TMR1CS = 0)
+#define TIMER1_COUNTER_MODE_ENABLE()   (T1CONbits.TMR1CS = 1)
+
+//Timer1 external clock input synchronization.
+#define TIMER1_ASYNC_COUNTER_MODE_ENABLE()   (T1CONbits.T1SYNC = 1)
+#define TIMER1_SYNC_COUNTER_MODE_ENABLE()    (T1CONbits.T1SYNC = 0)
+
+//Timer1 oscillator enable.
+#define TIMER1_OSC_HW_ENABLE()   (T1CONbits.T1OSCEN = 1)
+#define TIMER1_OSC_HW_DISABLE()  (T1CONbits.T1OSCEN = 0)
+
+//Timer1 prescaler value.
+#define TIMER1_PRESCALER_SELECT(_PRESCALER_)   (T1CONbits.T1CKPS = _PRESCALER_)
+
+//Timer1 read/write register mode selection.
+#define TIMER1_RW_REG_8BIT_MODE_ENABLE()     (T1CONbits.RD16 = 0)
+#define TIMER1_RW_REG_16BIT_MODE_ENABLE()    (T1CONbits.RD16 = 1)
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Timer1 Prescaler values
+ * 
+ */
+typedef enum
+{
+    TIMER1_PRESCALER_DIV_1 = 0,
+    TIMER1_PRESCALER_DIV_2,
+    TIMER1_PRESCALER_DIV_4,
+    TIMER1_PRESCALER_DIV_8
+}timer1_prescaler_t;
+
+typedef struct
+{
+#if TIMER1_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    void (* TMR1_InterruptHandler)(void);
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority priority;    
+#endif
+#endif
+    uint16 timer1_preload;               // Value to write as start in TMR1L and TMR1H registers
+    uint8 timer1_prescaler_value : 2;    // @ref timer1_prescaler_t
+    uint8 timer1_mode : 1;               // Timer1 mode selection.
+    uint8 timer1_counter_mode : 1;       // Timer1 external clock input synchronization.
+    uint8 timer1_reg_wr_mode : 1;        // Timer1 read/write register mode selection.
+    uint8 timer1_osc_cfg : 1;            // Timer1 oscillator selection.
+    uint8 timer1_reserved : 2;
+}timer1_t;
+
+/* -------------- Software Interfaces Declarations --------------*/
+/**
+ * @brief Initializes Timer1 based on the provided configuration.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Init(const timer1_t *timer1);
+
+/**
+ * @brief De-Initializes the Timer1 Module.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_DeInit(const timer1_t *timer1);
+
+/**
+ * @brief Writes a 16-bit value to Timer1. 
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @param val The 16-bit value to write to Timer1.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Write_Value(const timer1_t *timer1, uint16 val);
+
+/**
+ * @brief Reads a 16-bit value from Timer1.
+ * 
+ * @param timer1 A pointer to the Timer1 configuration structure.
+ * @param val A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer1_Read(const timer1_t *timer1, uint16 *val);
+
+#endif	/* TIMER1_H */
+
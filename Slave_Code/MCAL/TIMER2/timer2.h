@@ -0,0 +1,123 @@
+/* 
+ * File:   timer2.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 4:10 AM
+ */
+
+#ifndef TIMER2_H
+#define	TIMER2_H
+
+/* -------------- Includes -------------- */
+#include <pic18f4620.h>
+#include "../std_types.h"
+#include "../interrupt/internal_interrupt.h"
+
+/* -------------- Macro Declarations ------------- */
+
+/* -------------- Macro Functions Declarations --------------*/
+//This macro enables timer2.
+#define TIMER2_MODULE_ENABLE()   (T2CONbits.TMR2ON = 1)
+//This macro disables timer2.
+#define TIMER2_MODULE_DISABLE()  (T2CONbits.TMR2ON = 0)
+
+//Timer2 prescaler value.
+#define TIMER2_PRESCALER_SELECT(_PRESCALER_)    (T2CONbits.T2CKPS = _PRESCALER_)
+//Timer2 postscaler value (affects the interrupt flag only, not the PWM period).
+#define TIMER2_POSTSCALER_SELECT(_POSTSCALER_)  (T2CONbits.TOUTPS = _POSTSCALER_)
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Timer2 Prescaler values
+ * 
+ */
+typedef enum
+{
+    TIMER2_PRESCALER_DIV_1 = 0,
+    TIMER2_PRESCALER_DIV_4,
+    TIMER2_PRESCALER_DIV_16
+}timer2_prescaler_t;
+
+/**
+ * @brief Timer2 Postscaler values
+ * 
+ */
+typedef enum
+{
+    TIMER2_POSTSCALER_DIV_1 = 0,
+    TIMER2_POSTSCALER_DIV_2,
+    TIMER2_POSTSCALER_DIV_3,
+    TIMER2_POSTSCALER_DIV_4,
+    TIMER2_POSTSCALER_DIV_5,
+    TIMER2_POSTSCALER_DIV_6,
+    TIMER2_POSTSCALER_DIV_7,
+    TIMER2_POSTSCALER_DIV_8,
+    TIMER2_POSTSCALER_DIV_9,
+    TIMER2_POSTSCALER_DIV_10,
+    TIMER2_POSTSCALER_DIV_11,
+    TIMER2_POSTSCALER_DIV_12,
+    TIMER2_POSTSCALER_DIV_13,
+    TIMER2_POSTSCALER_DIV_14,
+    TIMER2_POSTSCALER_DIV_15,
+    TIMER2_POSTSCALER_DIV_16
+}timer2_postscaler_t;
+
+typedef struct
+{
+#if TIMER2_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    void (* TMR2_InterruptHandler)(void);
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority priority;    
+#endif
+#endif
+    uint8 timer2_preload;                // Value to write as start in TMR2 register
+    uint8 timer2_postscaler_value : 4;   // @ref timer2_postscaler_t
+    uint8 timer2_prescaler_value : 2;    // @ref timer2_prescaler_t
+    uint8 timer2_reserved : 2;
+}timer2_t;
+
+/* -------------- Software Interfaces Declarations --------------*/
+/**
+ * @brief Initializes Timer2 based on the provided configuration.
+ * 
+ * @param timer2 A pointer to the Timer2 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer2_Init(const timer2_t *timer2);
+
+/**
+ * @brief De-Initializes the Timer2 Module.
+ * 
+ * @param timer2 A pointer to the Timer2 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer2_DeInit(const timer2_t *timer2);
+
+/**
+ * @brief Writes an 8-bit value to Timer2. 
+ * 
+ * @param timer2 A pointer to the Timer2 configuration structure.
+ * @param val The 8-bit value to write to Timer2.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer2_Write_Value(const timer2_t *timer2, uint8 val);
+
+/**
+ * @brief Reads an 8-bit value from Timer2.
+ * 
+ * @param timer2 A pointer to the Timer2 configuration structure.
+ * @param val A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer2_Read(const timer2_t *timer2, uint8 *val);
+
+#endif	/* TIMER2_H */
+
@@ -0,0 +1,227 @@
+/* 
+ * File:   timer3.c
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 2:05 AM
+ */
+
+#include "timer3.h"
+
+#if TIMER3_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+static void (*TMR3_InterruptHandler)(void) = NULL;
+#endif
+
+static inline void Timer3_Mode_Select(const timer3_t *timer3);
+static inline void Timer3_RW_Reg_Mode_Select(const timer3_t *timer3);
+
+static uint16 preload = ZERO_INIT;
+
+/**
+ * @brief Initializes Timer3 based on the provided configuration.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Init(const timer3_t *timer3)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer3)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable the Timer3 Module
+        TIMER3_MODULE_DISABLE();
+        //Configure the Prescaler
+        TIMER3_PRESCALER_SELECT(timer3->timer3_prescaler_value);
+        //Select the Timer3 Mode
+        Timer3_Mode_Select(timer3);
+        //Select the read/write register mode (8bits or 16bits)
+        Timer3_RW_Reg_Mode_Select(timer3);
+        //Write preload value if there is.
+        TMR3H = (timer3->timer3_preload >> 8);
+        TMR3L = (uint8) (timer3->timer3_preload);
+        //Store the preload value 
+        preload = timer3->timer3_preload;
+
+        //Configure the interrupt
+#if TIMER3_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        TIMER3_INTERRUPT_ENABLE();
+        TIMER3_INTERRUPT_FLAG_CLEAR();
+        TMR3_InterruptHandler = timer3->TMR3_InterruptHandler;
+        //Interrupt priority configurations
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelsEnable();
+        if(INTERRUPT_HIGH_PRIORITY == timer3->priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            TIMER3_INT_HIGH_PRIORITY();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == timer3->priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            TIMER3_INT_LOW_PRIORITY();
+        }else{/* Nothing */}
+#else 
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+        //Enable the Timer3 Module
+        TIMER3_MODULE_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief De-Initializes the Timer3 Module.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_DeInit(const timer3_t *timer3)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer3)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //Disable Timer3 Module
+        TIMER3_MODULE_DISABLE();
+        //Disable Timer3 Interrupt
+#if TIMER3_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+        TIMER3_INTERRUPT_DISABLE();
+#endif
+    }
+    return ret;
+}
+
+/**
+ * @brief Writes a 16-bit value to Timer3. 
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @param val The 16-bit value to write to Timer3.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Write_Value(const timer3_t *timer3, uint16 val)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (NULL == timer3)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        TMR3H = (uint8)(val >> 8);
+        TMR3L = (uint8) (val);
+    }
+    return ret;
+}
+
+/**
+ * @brief Reads a 16-bit value from Timer3.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @param val A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Read(const timer3_t *timer3, uint16 *val)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tmr3l = ZERO_INIT, l_tmr3h = ZERO_INIT;
+
+    if (NULL == timer3 || NULL == val)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        //TMR3L must be read first, in 16-bit mode it latches TMR3H
+        l_tmr3l = TMR3L;
+        l_tmr3h = TMR3H;
+        *val = (uint16) ((l_tmr3h << 8) + l_tmr3l);
+    }
+    return ret;
+} 
+
+/**
+ * @brief The Timer3 interrupt MCAL helper function
+ * 
+ */
+void TMR3_ISR(void)
+{
+    #if TIMER3_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    //Timer3 interrupt occurred, the flag must be cleared.
+    TIMER3_INTERRUPT_FLAG_CLEAR();
+    //Write the preload value every time this ISR executes. The overflow already restarts the timer
+    //from 0, so a preload of 0 isn't written: the counts since the overflow are kept for the callback.
+    if(ZERO_INIT != preload)
+    {
+        TMR3H = (uint8)(preload >> 8);
+        TMR3L = (uint8) (preload);
+    }else{/* Nothing */}
+    //CallBack func gets called every time this ISR executes.
+    if(TMR3_InterruptHandler)
+    {
+        TMR3_InterruptHandler();
+    }else{/* Nothing */}
+    #endif
+}
+
+/**
+ * @brief Helper function to select the mode (Timer or Counter).
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ */
+static inline void Timer3_Mode_Select(const timer3_t *timer3)
+{
+    if(TIMER3_TIMER_MODE == timer3->timer3_mode)
+    {
+        TIMER3_TIMER_MODE_ENABLE();
+    }
+    else if(TIMER3_COUNTER_MODE == timer3->timer3_mode)
+    {
+        TIMER3_COUNTER_MODE_ENABLE();
+        if(TIMER3_ASYNC_COUNTER_MODE == timer3->timer3_counter_mode)
+        {
+            TIMER3_ASYNC_COUNTER_MODE_ENABLE();
+        }
+        else if(TIMER3_SYNC_COUNTER_MODE == timer3->timer3_counter_mode)
+        {
+            TIMER3_SYNC_COUNTER_MODE_ENABLE();
+        }
+        else{/* Nothing */}
+    }
+    else{/* Nothing */}
+}
+
+/**
+ * @brief Helper function to configure the read/write register mode (8-bits or 16-bits). 
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ */
+static inline void Timer3_RW_Reg_Mode_Select(const timer3_t *timer3)
+{
+    if(TIMER3_RW_REG_16BIT_MODE == timer3->timer3_reg_wr_mode)
+    {
+        TIMER3_RW_REG_16BIT_MODE_ENABLE();
+    }
+    else if(TIMER3_RW_REG_8BIT_MODE == timer3->timer3_reg_wr_mode)
+    {
+        TIMER3_RW_REG_8BIT_MODE_ENABLE();
+    }else{/* Nothing */}
+}
@@ -0,0 +1,123 @@
+/* 
+ * File:   timer3.h
+ * Author: Mohamed Sameh
+ *
+ * Created on October 19, 2026, 2:05 AM
+ */
+
+#ifndef TIMER3_H
+#define	TIMER3_H
+
+/* -------------- Includes -------------- */
+#include <pic18f4620.h>
+#include "../std_types.h"
+#include "../interrupt/internal_interrupt.h"
+
+/* -------------- Macro Declarations ------------- */
+//Timer3 mode selection.
+#define TIMER3_TIMER_MODE        0
+#define TIMER3_COUNTER_MODE      1
+
+//Timer3 external clock input synchronization (Counter mode).
+#define TIMER3_ASYNC_COUNTER_MODE     1
+#define TIMER3_SYNC_COUNTER_MODE      0
+
+//Timer3 read/write register mode selection.
+#define TIMER3_RW_REG_8BIT_MODE       0
+#define TIMER3_RW_REG_16BIT_MODE      1
+
+/* -------------- Macro Functions Declarations --------------*/
+//This macro enables timer3.
+#define TIMER3_MODULE_ENABLE()   (T3CONbits.TMR3ON = 1)
+//This macro disables timer3.
+#define TIMER3_MODULE_DISABLE()  (T3CONbits.TMR3ON = 0)
+
+//Timer3 mode selection.
+#define TIMER3_TIMER_MODE_ENABLE()     (T3CONbits.TMR3CS = 0)
+#define TIMER3_COUNTER_MODE_ENABLE()   (T3CONbits.TMR3CS = 1)
+
+//Timer3 external clock input synchronization.
+#define TIMER3_ASYNC_COUNTER_MODE_ENABLE()   (T3CONbits.T3SYNC = 1)
+#define TIMER3_SYNC_COUNTER_MODE_ENABLE()    (T3CONbits.T3SYNC = 0)
+
+//Timer3 prescaler value.
+#define TIMER3_PRESCALER_SELECT(_PRESCALER_)   (T3CONbits.T3CKPS = _PRESCALER_)
+
+//Timer3 read/write register mode selection.
+#define TIMER3_RW_REG_8BIT_MODE_ENABLE()     (T3CONbits.RD16 = 0)
+#define TIMER3_RW_REG_16BIT_MODE_ENABLE()    (T3CONbits.RD16 = 1)
+
+/* -------------- Data Types Declarations --------------  */
+/**
+ * @brief Timer3 Prescaler values
+ * 
+ */
+typedef enum
+{
+    TIMER3_PRESCALER_DIV_1 = 0,
+    TIMER3_PRESCALER_DIV_2,
+    TIMER3_PRESCALER_DIV_4,
+    TIMER3_PRESCALER_DIV_8
+}timer3_prescaler_t;
+
+typedef struct
+{
+#if TIMER3_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+    void (* TMR3_InterruptHandler)(void);
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+    interrupt_priority priority;    
+#endif
+#endif
+    uint16 timer3_preload;               // Value to write as start in TMR3L and TMR3H registers
+    uint8 timer3_prescaler_value : 2;    // @ref timer3_prescaler_t
+    uint8 timer3_mode : 1;               // Timer3 mode selection.
+    uint8 timer3_counter_mode : 1;       // Timer3 external clock input synchronization.
+    uint8 timer3_reg_wr_mode : 1;        // Timer3 read/write register mode selection.
+    uint8 timer3_reserved : 3;
+}timer3_t;
+
+/* -------------- Software Interfaces Declarations --------------*/
+/**
+ * @brief Initializes Timer3 based on the provided configuration.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Init(const timer3_t *timer3);
+
+/**
+ * @brief De-Initializes the Timer3 Module.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_DeInit(const timer3_t *timer3);
+
+/**
+ * @brief Writes a 16-bit value to Timer3. 
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @param val The 16-bit value to write to Timer3.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Write_Value(const timer3_t *timer3, uint16 val);
+
+/**
+ * @brief Reads a 16-bit value from Timer3.
+ * 
+ * @param timer3 A pointer to the Timer3 configuration structure.
+ * @param val A pointer to store the value.
+ * @return Std_ReturnType A status indicating the success or failure of the operation.
+ *         - E_OK: The operation was successful.
+ *         - E_NOT_OK: An error occurred during the operation.
+ */
+Std_ReturnType Timer3_Read(const timer3_t *timer3, uint16 *val);
+
+#endif	/* TIMER3_H */
+
@@ -182,6 +182,22 @@
 #define EUSART_RX_INT_LOW_PRIORITY()       (IPR1bits.RCIP = 0)
 #endif
 
+#if EEPROM_INTERRUPT_ENABLE_FEATURE==INTERRUPT_FEATURE_ENABLE
+//This macro enables the interrupt for the data EEPROM write.
+#define EEPROM_INTERRUPT_ENABLE()      (PIE2bits.EEIE = 1)
+//This macro disables the interrupt for the data EEPROM write.
+#define EEPROM_INTERRUPT_DISABLE()     (PIE2bits.EEIE = 0)
+//This macro clears the interrupt flag for the data EEPROM write.
+#define EEPROM_INTERRUPT_FLAG_CLEAR()  (PIR2bits.EEIF = 0)
+
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE==INTERRUPT_FEATURE_ENABLE
+//This macro sets the data EEPROM write interrupt as high priority.
+#define EEPROM_INT_HIGH_PRIORITY()      (IPR2bits.EEIP = 1)
+//This macro sets the data EEPROM write interrupt as low priority.
+#define EEPROM_INT_LOW_PRIORITY()       (IPR2bits.EEIP = 0)
+#endif
+#endif
+
 /* -------------- Macro Functions Declarations --------------*/
 
 /* -------------- Data Types Declarations --------------  */
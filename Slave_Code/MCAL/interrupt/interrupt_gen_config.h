@@ -16,15 +16,21 @@
 #define EXTERNAL_INTERRUPT_INTx_ENABLE            INTERRUPT_FEATURE_ENABLE  
 #define EXTERNAL_INTERRUPT_ONCHANGE_ENABLE        INTERRUPT_FEATURE_ENABLE 
 
-//#define ADC_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
+#define ADC_INTERRUPT_ENABLE_FEATURE              INTERRUPT_FEATURE_ENABLE
 
 #define TIMER0_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
-#define TIMER1_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
-#define TIMER2_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
+//Timer1 only clocks the CCP2 sampling trigger, the match resets it before it overflows
+//#define TIMER1_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
+//Timer2 only clocks the hardware PWM, its interrupt is left off so the PWM costs no CPU time
+//#define TIMER2_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
 #define TIMER3_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
 
+//EEIF drives the queued EEPROM writes
+#define EEPROM_INTERRUPT_ENABLE_FEATURE           INTERRUPT_FEATURE_ENABLE
+
 #define CCP1_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
-#define CCP2_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
+//CCP2 starts the A/D conversions in hardware, only the ADC interrupt runs per sample
+//#define CCP2_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
 
 //#define SPI_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
 #define I2C_INTERRUPT_ENABLE_FEATURE             INTERRUPT_FEATURE_ENABLE
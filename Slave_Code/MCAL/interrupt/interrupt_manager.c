@@ -110,13 +110,50 @@ void __interrupt() InterruptManager(void)
     /*_________________________ RB6 END _________________________________*/
     /*_________________________ PORTB external on change interrupt end _________________________________*/
 
+    /*_________________________ ADC START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.ADIE && INTERRUPT_OCCURRED == PIR1bits.ADIF)
+    {
+        ADC_ISR(); /* ADC INTERRUPT */
+    }
+    /*_________________________ ADC END _________________________________*/
+
     /*_________________________ TIMER START _________________________________*/
     if(INTERRUPT_ENABLE == INTCONbits.TMR0IE && INTERRUPT_OCCURRED == INTCONbits.TMR0IF)
     {
         TMR0_ISR(); /* TIMER0 INTERRUPT */
     }
+    if(INTERRUPT_ENABLE == PIE1bits.TMR1IE && INTERRUPT_OCCURRED == PIR1bits.TMR1IF)
+    {
+        TMR1_ISR(); /* TIMER1 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.TMR2IE && INTERRUPT_OCCURRED == PIR1bits.TMR2IF)
+    {
+        TMR2_ISR(); /* TIMER2 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.TMR3IE && INTERRUPT_OCCURRED == PIR2bits.TMR3IF)
+    {
+        TMR3_ISR(); /* TIMER3 INTERRUPT */
+    }
     /*_________________________ TIMER END _________________________________*/
 
+    /*_________________________ CCP START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.CCP1IE && INTERRUPT_OCCURRED == PIR1bits.CCP1IF)
+    {
+        CCP1_ISR(); /* CCP1 INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE2bits.CCP2IE && INTERRUPT_OCCURRED == PIR2bits.CCP2IF)
+    {
+        CCP2_ISR(); /* CCP2 INTERRUPT */
+    }
+    /*_________________________ CCP END _________________________________*/
+
+    /*_________________________ EEPROM START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE2bits.EEIE && INTERRUPT_OCCURRED == PIR2bits.EEIF)
+    {
+        EEPROM_ISR(); /* EEPROM WRITE INTERRUPT */
+    }
+    /*_________________________ EEPROM END _________________________________*/
+
     /*_________________________ SPI START _________________________________*/
     if(INTERRUPT_ENABLE == PIE1bits.SSPIE && INTERRUPT_OCCURRED == PIR1bits.SSPIF && SSPCON1bits.SSPM <= 5)
     {
@@ -124,6 +161,17 @@ void __interrupt() InterruptManager(void)
     }
     /*_________________________ SPI END _________________________________*/
 
+    /*_________________________ EUSART START _________________________________*/
+    if(INTERRUPT_ENABLE == PIE1bits.RCIE && INTERRUPT_OCCURRED == PIR1bits.RCIF)
+    {
+        EUSART_RX_ISR(); /* EUSART RECEIVE INTERRUPT */
+    }
+    if(INTERRUPT_ENABLE == PIE1bits.TXIE && INTERRUPT_OCCURRED == PIR1bits.TXIF)
+    {
+        EUSART_TX_ISR(); /* EUSART TRANSMIT INTERRUPT */
+    }
+    /*_________________________ EUSART END _________________________________*/
+
 
 }
 
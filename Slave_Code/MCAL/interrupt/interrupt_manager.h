@@ -32,6 +32,7 @@ void TMR2_ISR(void);
 void TMR3_ISR(void);
 void CCP1_ISR(void);
 void CCP2_ISR(void);
+void EEPROM_ISR(void);
 
 void EUSART_TX_ISR(void);
 void EUSART_RX_ISR(void);
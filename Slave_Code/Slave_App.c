@@ -6,192 +6,707 @@
  */
 #include "Slave_App.h"
 
-volatile uint16 required_temperature = 24; // the required temperature which sent from Master with initial value 24
-volatile uint16 adc_res = 0; // the temperature of the room 
-volatile uint16 temp_sensor_reading = 0; // the temperature of the room 
-volatile uint8 counter = 0; // the counter which determine the periodic time of implementing ISR
-volatile uint8 last_air_conditioning_value = AIR_CONDTIONING_OFF; // last air conditioning value which will help in hysteresis
+sint16 required_temperature = SETPOINT_DEFAULT; // the required temperature in tenths of a degree which sent from Master
+sint16 rooms_temperature[ROOMS_NUM]; // the temperature of the rooms in tenths of a degree
+uint8 last_air_conditioning_value = AIR_CONDTIONING_OFF; // last air conditioning value which will help in hysteresis
+uint8 air_conditioning_speed = AC_SPEED_DEFAULT; // fan speed in percent, applied by the thermostat
+uint8 thermostat_enabled = FALSE; // the thermostat controls the air conditioning only when it's turned on by the master
+uint8 thermostat_mode = THERMOSTAT_MODE_PWM; // how the thermostat drives the air conditioning
+uint8 thermostat_output = 0; // last PI output in percent
+uint16 window_step = 0; // control step inside the time-proportioning window
+uint16 window_on_steps = 0; // on-time of the current window in control steps
+volatile uint8 control_due = FALSE; // set by Timer0 at the control rate
+pi_controller_t Thermostat_pi; // PI controller of the thermostat room
+uint8 thermostat_deadband = THERMOSTAT_DEADBAND_DEFAULT; // hysteresis band in tenths of a degree
+
+uint8 ac_running = FALSE; // the compressor is running (fan duty isn't zero)
+uint8 ac_min_on = AC_MIN_ON_DEFAULT; // minimum on-time in minutes
+uint8 ac_min_off = AC_MIN_OFF_DEFAULT; // minimum off-time in minutes
+uint16 ac_lockout = 0; // seconds before the compressor may change its state again
+uint16 ac_switch_count = 0; // starts and stops of the compressor since reset
+
+temp_sensor_iir_t rooms_filter[ROOMS_NUM]; // IIR state of the room sensors
+uint8 rooms_results_count[ROOMS_NUM]; // decimated results of every room already filtered
+temp_history_t Room_history; // samples of the thermostat room for the trend and the statistics
+uint32 uptime_seconds = 0; // control steps since reset, the timestamps of the history
+
+sint16 rooms_raw_temperature[ROOMS_NUM]; // the temperature of the rooms before the calibration
+temp_sensor_calib_t rooms_calib[ROOMS_NUM]; // calibration of the room sensors, loaded from the EEPROM
+uint8 calib_room = 0; // room of the calibration in progress
+uint8 calib_points = 0; // points of the calibration in progress already captured
+sint16 calib_raw[CALIB_POINTS_NUM]; // uncalibrated readings at the reference points
+sint16 calib_ref[CALIB_POINTS_NUM]; // reference temperatures in tenths of a degree
 
 int main()
 {
     /*****************  INITIALIZE  ***********************/
     application_init();
+    pi_controller_init(&Thermostat_pi, THERMOSTAT_KP_DEFAULT, THERMOSTAT_KI_DEFAULT);
+    temp_history_init(&Room_history);
+    Calibration_Load();
     
     uint8 request = DEFAULT_ACK;//the value that is received from the master
 	uint8 response = DEFAULT_ACK;//the values that is sent back to the master
-    logic_t led_logic = 0xFF;
+    uint8 room = 0;//room number of the dimming commands
+    uint8 level = SOFT_PWM_LEVEL_OFF;//brightness level of the dimming commands
+    uint16 pwm_cycles_last = 0;//PWM interrupt cycles of the last period
+    uint16 pwm_cycles_max = 0;//maximum PWM interrupt cycles of a period
+    uint16 convert_cycles = 0;//cycles of the Q8.8 conversion of a result
+    uint16 float_cycles = 0;//cycles of the float conversion it replaced
+    uint8 scene_on = 0x00;//devices to turn on by a scene command
+    uint8 scene_off = 0x00;//devices to turn off by a scene command
+    uint8 spi_status = SPI_DATA_NOT_RECEIVED;//a new request is received or not
+    uint8 room_counter = 0;//counter of the rooms in the bulk commands
+    uint8 scan_rate = 0;//conversions per second of a temperature channel
+    sint16 setpoint = 0;//required temperature received from the master
+    uint8 calib_point = 0;//reference point of the calibration commands
+    temp_sensor_calib_t calib;//calibration computed from the captured points
+    uint8 gain_kp = 0;//proportional gain of the thermostat
+    uint8 gain_ki = 0;//integral gain of the thermostat
+    uint8 min_on = 0, min_off = 0, deadband = 0;//compressor protection received from the master
+    uint8 history_samples = 0;//samples of the history sent in one stream
+    sint8 history_delta = 0;//change of a history sample from the previous one
+    temp_history_cursor_t history_cursor;//position of the stream in the history
+    temp_history_stats_t history_stats;//statistics of a history window
     
+    SPI_Write_Data_Nonblocking(DEFAULT_ACK);
     while(1)
     {
-        request = SPI_Transfer_data(DEFAULT_ACK);
-        switch (request)
+        /*the SPI is polled without waiting so the thermostat keeps running between the requests*/
+        SPI_Read_Data_Nonblocking(&request, &spi_status);
+        if(SPI_DATA_RECEIVED == spi_status)
         {
-            /*********************************   STATUS COMMANDS ********************************/
-			//commands related to send the current status back to the master
-			case ROOM1_STATUS:
-                led_read(&Room1_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
-                
-                SPI_Transfer_data(response);         
-                break;
-                
-            case ROOM2_STATUS:
-                led_read(&Room2_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
-                
-                SPI_Transfer_data(response);         
-                break;
-            
-            case ROOM3_STATUS:
-                led_read(&Room3_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
-                
-                SPI_Transfer_data(response);         
-                break;
-                
-            case ROOM4_STATUS:
-                led_read(&Room4_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
-                
-                SPI_Transfer_data(response);         
-                break;
-                
-            case AIR_COND_STATUS:
-                led_read(&Air_Cond_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
+            switch (request)
+            {
+                /*********************************   STATUS COMMANDS ********************************/
+    			//commands related to send the current status back to the master
+    			case ROOM1_STATUS:
+                case ROOM2_STATUS:
+                case ROOM3_STATUS:
+                case ROOM4_STATUS:
+                case TV_STATUS:
+                case AIR_COND_STATUS:
+                    if(Devices_State() & Device_Bit(request))
+                    {
+                        response = ON_STATUS;//set the response as on status
+                    }
+                    else
+                    {
+                        response = OFF_STATUS;//set the response as off status
+                    }
+                    SPI_Transfer_data(response);
+                    break;
                 
-                SPI_Transfer_data(response);
-                break;
-                
-            case TV_STATUS:
-                led_read(&TV_led, &led_logic);
-                if(GPIO_LOW == led_logic)
-                {
-                    response = OFF_STATUS;//set the response as off status
-                }
-                else if(GPIO_HIGH == led_logic)
-                {
-                    response = ON_STATUS;//set the response as on status
-                }else{/* Nothing */}     
-                
-                SPI_Transfer_data(response);
-                break;
-                
-            /*********************************   TURN ON COMMANDS ********************************/
-            case ROOM1_TURN_ON:
-                led_turn_on(&Room1_led);//turn on the led of room 1
-                break;//break the switch case
-			case ROOM2_TURN_ON:
-                led_turn_on(&Room2_led);//turn on the led of room 2
-                break;//break the switch case
-			case ROOM3_TURN_ON:
-                led_turn_on(&Room3_led);//turn on the led of room 3
-                break;//break the switch case
-			case ROOM4_TURN_ON:
-                led_turn_on(&Room4_led);//turn on the led of room 4
-                break;//break the switch case
-			case AIR_COND_TURN_ON:
-                Timer0_Init(&timer);
-                led_turn_on(&Air_Cond_led);//turn on the led of air conditioning
-                break;//break the switch case
-			case TV_TURN_ON:
-                led_turn_on(&TV_led);//turn on the led of the TV
-                break;//break the switch case
-            /*********************************   TURN OFF COMMANDS ********************************/
-            case ROOM1_TURN_OFF:
-                led_turn_off(&Room1_led);//turn off the led of room 1
-                break;//break the switch case
-			case ROOM2_TURN_OFF:
-                led_turn_off(&Room2_led);//turn off the led of room 2
-                break;//break the switch case
-			case ROOM3_TURN_OFF:
-                led_turn_off(&Room3_led);//turn off the led of room 3
-                break;//break the switch case
-			case ROOM4_TURN_OFF:
-                led_turn_off(&Room4_led);//turn off the led of room 4
-                break;//break the switch case
-			case AIR_COND_TURN_OFF:
-                Timer0_DeInit(&timer);
-                led_turn_off(&Air_Cond_led);//turn off the led of air conditioning
-                break;//break the switch case
-			case TV_TURN_OFF:
-                led_turn_off(&TV_led);//turn off the led of the TV
-                break;//break the switch case
-            /*********************************   Set temperature   ********************************/
-            case SET_TEMPERATURE:
-                required_temperature = SPI_Transfer_data(DEFAULT_ACK);
-                break;
+                case DEVICES_STATUS:
+                    SPI_Transfer_data(Devices_State());//the state of all devices in one byte
+                    break;
                 
+                /*********************************   TURN ON COMMANDS ********************************/
+                case ROOM1_TURN_ON:
+    			case ROOM2_TURN_ON:
+    			case ROOM3_TURN_ON:
+    			case ROOM4_TURN_ON:
+                    Rooms_Apply(Device_Bit(request), LED_BANK_NO_CHANGE);//turn on the light of the room at full level
+                    break;//break the switch case
+    			case TV_TURN_ON:
+                    led_bank_apply(&Devices_bank, Device_Bit(request), LED_BANK_NO_CHANGE);//turn on the led of the device
+                    break;//break the switch case
+    			case AIR_COND_TURN_ON:
+                    thermostat_enabled = TRUE;
+                    Thermostat_Reset();//the PI loop starts from zero
+                    if(THERMOSTAT_MODE_HYSTERESIS == thermostat_mode)//the PI modes switch it on their next control step
+                    {
+                        Air_Cond_Output(AIR_CONDTIONING_ON);//turn on the air conditioning
+                    }
+                    break;//break the switch case
+                /*********************************   TURN OFF COMMANDS ********************************/
+                case ROOM1_TURN_OFF:
+    			case ROOM2_TURN_OFF:
+    			case ROOM3_TURN_OFF:
+    			case ROOM4_TURN_OFF:
+                    Rooms_Apply(LED_BANK_NO_CHANGE, Device_Bit(request));//turn off the light of the room
+                    break;//break the switch case
+    			case TV_TURN_OFF:
+                    led_bank_apply(&Devices_bank, LED_BANK_NO_CHANGE, Device_Bit(request));//turn off the led of the device
+                    break;//break the switch case
+    			case AIR_COND_TURN_OFF:
+                    thermostat_enabled = FALSE;
+                    Air_Cond_Stop();//turn off the air conditioning even inside its minimum on-time
+                    break;//break the switch case
+                /*********************************   Set temperature   ********************************/
+                case SET_TEMPERATURE:
+                    setpoint = (sint16)((uint16)SPI_Transfer_data(DEFAULT_ACK) << 8);//tenths of a degree, high byte first
+                    setpoint |= SPI_Transfer_data(DEFAULT_ACK);
+                    if((setpoint >= SETPOINT_MIN) && (setpoint <= SETPOINT_MAX))
+                    {
+                        required_temperature = setpoint;
+                    }
+                    break;
+                case GET_TEMPERATURE:
+                    //the thermostat room then the required temperature, in tenths of a degree, high byte first
+                    SPI_Transfer_data((uint8)((uint16)rooms_temperature[THERMOSTAT_ROOM] >> 8));
+                    SPI_Transfer_data((uint8)rooms_temperature[THERMOSTAT_ROOM]);
+                    SPI_Transfer_data((uint8)((uint16)required_temperature >> 8));
+                    SPI_Transfer_data((uint8)required_temperature);
+                    break;
+                /*********************************   Scene   ********************************/
+                case SET_SCENE:
+                    scene_on = SPI_Transfer_data(DEFAULT_ACK);//devices to turn on
+                    scene_off = SPI_Transfer_data(DEFAULT_ACK);//devices to turn off
+                    //the lights go through the PWM engine, the rest is switched together in one latch store
+                    Rooms_Apply(scene_on & ROOMS_MASK, scene_off & ROOMS_MASK);
+                    led_bank_apply(&Devices_bank, scene_on & SCENE_DEVICES_MASK & ~ROOMS_MASK,
+                                   scene_off & SCENE_DEVICES_MASK & ~ROOMS_MASK);
+                    break;
+                /*********************************   Dimming   ********************************/
+                case SET_LEVEL:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number 1..4
+                    level = SPI_Transfer_data(DEFAULT_ACK);//brightness 0..255
+                    soft_pwm_set_level(room - 1, level);
+                    break;
+                case GET_LEVEL:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number 1..4
+                    level = SOFT_PWM_LEVEL_OFF;
+                    soft_pwm_get_level(room - 1, &level);
+                    SPI_Transfer_data(level);
+                    break;
+                case GET_PWM_LOAD:
+                    soft_pwm_get_isr_load(&pwm_cycles_last, &pwm_cycles_max);
+                    SPI_Transfer_data((uint8)(pwm_cycles_last >> 8));
+                    SPI_Transfer_data((uint8)pwm_cycles_last);
+                    SPI_Transfer_data((uint8)(pwm_cycles_max >> 8));
+                    SPI_Transfer_data((uint8)pwm_cycles_max);
+                    break;
+                case GET_CONVERT_LOAD:
+                    Convert_Measure(&convert_cycles, &float_cycles);//Q8.8 then float cycles, high byte first
+                    SPI_Transfer_data((uint8)(convert_cycles >> 8));
+                    SPI_Transfer_data((uint8)convert_cycles);
+                    SPI_Transfer_data((uint8)(float_cycles >> 8));
+                    SPI_Transfer_data((uint8)float_cycles);
+                    break;
+                /*********************************   Air conditioning speed   ********************************/
+                case SET_AC_SPEED:
+                    response = SPI_Transfer_data(DEFAULT_ACK);//speed in percent
+                    if(response <= CCP_PWM_DUTY_MAX)
+                    {
+                        air_conditioning_speed = response;//the thermostat applies the new speed on its next check
+                    }
+                    break;
+                case GET_AC_SPEED:
+                    SPI_Transfer_data(air_conditioning_speed);
+                    break;
+                /*********************************   Room temperatures   ********************************/
+                case GET_ALL_TEMPS:
+                    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)//tenths of a degree, high byte first
+                    {
+                        SPI_Transfer_data((uint8)((uint16)rooms_temperature[room_counter] >> 8));
+                        SPI_Transfer_data((uint8)rooms_temperature[room_counter]);
+                    }
+                    break;
+                case GET_SCAN_RATE:
+                    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)//conversions per second of every channel
+                    {
+                        adc_scan_get_rate(room_counter, &scan_rate);
+                        SPI_Transfer_data(scan_rate);
+                    }
+                    break;
+                case GET_TEMP_HISTORY:
+                    history_samples = SPI_Transfer_data(DEFAULT_ACK);//samples wanted, the newest ones
+                    if(E_OK == temp_history_seek(&Room_history, history_samples, &history_cursor))
+                    {
+                        history_samples = history_cursor.remaining + 1;
+                    }
+                    else//empty history
+                    {
+                        history_samples = 0;
+                    }
+                    //header: samples, period, time of the newest sample, then the first value and the deltas
+                    SPI_Transfer_data(history_samples);
+                    SPI_Transfer_data(TEMP_HISTORY_PERIOD_S);
+                    SPI_Transfer_data((uint8)(Room_history.newest_timestamp >> 24));
+                    SPI_Transfer_data((uint8)(Room_history.newest_timestamp >> 16));
+                    SPI_Transfer_data((uint8)(Room_history.newest_timestamp >> 8));
+                    SPI_Transfer_data((uint8)Room_history.newest_timestamp);
+                    if(history_samples > 0)
+                    {
+                        SPI_Transfer_data((uint8)((uint16)history_cursor.value >> 8));
+                        SPI_Transfer_data((uint8)history_cursor.value);
+                        while(E_OK == temp_history_next(&Room_history, &history_cursor, &history_delta))
+                        {
+                            SPI_Transfer_data((uint8)history_delta);
+                        }
+                    }
+                    break;
+                case GET_TEMP_STATS:
+                    response = SPI_Transfer_data(DEFAULT_ACK);//window index
+                    if(E_OK != temp_history_get_stats(&Room_history, response, &history_stats))//unknown window
+                    {
+                        history_stats.samples_num = 0;
+                        history_stats.min = 0;
+                        history_stats.max = 0;
+                        history_stats.average = 0;
+                    }
+                    SPI_Transfer_data(history_stats.samples_num);
+                    SPI_Transfer_data((uint8)((uint16)history_stats.min >> 8));
+                    SPI_Transfer_data((uint8)history_stats.min);
+                    SPI_Transfer_data((uint8)((uint16)history_stats.max >> 8));
+                    SPI_Transfer_data((uint8)history_stats.max);
+                    SPI_Transfer_data((uint8)((uint16)history_stats.average >> 8));
+                    SPI_Transfer_data((uint8)history_stats.average);
+                    break;
+                /*********************************   Sensor calibration   ********************************/
+                case CALIB_POINT:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number, 1 based
+                    calib_point = SPI_Transfer_data(DEFAULT_ACK);//0 or 1
+                    setpoint = (sint16)((uint16)SPI_Transfer_data(DEFAULT_ACK) << 8);//reference temperature, high byte first
+                    setpoint |= SPI_Transfer_data(DEFAULT_ACK);
+                    if((room == 0) || (room > ROOMS_NUM) || (calib_point >= CALIB_POINTS_NUM))
+                    {
+                        break;
+                    }
+                    if(calib_room != (room - 1))//the points of another room are dropped
+                    {
+                        calib_room = room - 1;
+                        calib_points = 0;
+                    }
+                    calib_raw[calib_point] = rooms_raw_temperature[calib_room];//the reading before the old calibration
+                    calib_ref[calib_point] = setpoint;
+                    calib_points |= (uint8)(1 << calib_point);
+                    break;
+                case CALIB_APPLY:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number, 1 based
+                    response = CALIB_FAILED;
+                    if((room == (calib_room + 1)) && (CALIB_ALL_POINTS == calib_points) &&
+                       (E_OK == temp_sensor_calib_two_point(calib_raw[0], calib_ref[0], calib_raw[1], calib_ref[1], &calib)))
+                    {
+                        rooms_calib[calib_room] = calib;
+                        if(E_OK == Calibration_Store(calib_room))
+                        {
+                            calib_points = 0;
+                            response = CALIB_DONE;
+                        }
+                        else//the points are kept, the master can apply them again
+                        {
+                            response = CALIB_NOT_SAVED;
+                        }
+                    }
+                    SPI_Transfer_data(response);
+                    break;
+                case CALIB_RESET:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number, 1 based
+                    if((room > 0) && (room <= ROOMS_NUM))
+                    {
+                        rooms_calib[room - 1].gain_q14 = TEMP_SENSOR_GAIN_ONE;//back to the ideal sensor
+                        rooms_calib[room - 1].offset_deci = 0;
+                        Calibration_Store(room - 1);
+                        calib_points = 0;
+                    }
+                    break;
+                case GET_CALIB:
+                    room = SPI_Transfer_data(DEFAULT_ACK);//room number, 1 based
+                    if((room == 0) || (room > ROOMS_NUM))
+                    {
+                        room = 1;//the reply keeps its length, the master checks the room before asking
+                    }
+                    SPI_Transfer_data((uint8)(rooms_calib[room - 1].gain_q14 >> 8));
+                    SPI_Transfer_data((uint8)rooms_calib[room - 1].gain_q14);
+                    SPI_Transfer_data((uint8)((uint16)rooms_calib[room - 1].offset_deci >> 8));
+                    SPI_Transfer_data((uint8)rooms_calib[room - 1].offset_deci);
+                    break;
+                /*********************************   Thermostat control   ********************************/
+                case SET_CTRL_MODE:
+                    response = SPI_Transfer_data(DEFAULT_ACK);//control mode
+                    if((response < THERMOSTAT_MODES_NUM) && (response != thermostat_mode))
+                    {
+                        thermostat_mode = response;
+                        Thermostat_Reset();
+                    }
+                    break;
+                case SET_PI_GAINS:
+                    gain_kp = SPI_Transfer_data(DEFAULT_ACK);//percent per degree
+                    gain_ki = SPI_Transfer_data(DEFAULT_ACK);//percent per degree per minute
+                    pi_controller_set_gains(&Thermostat_pi, gain_kp, gain_ki);
+                    break;
+                case GET_CTRL_STATE:
+                    SPI_Transfer_data(thermostat_mode);
+                    SPI_Transfer_data(Thermostat_pi.kp);
+                    SPI_Transfer_data(Thermostat_pi.ki);
+                    SPI_Transfer_data(thermostat_output);
+                    break;
+                case SET_AC_PROTECT:
+                    min_on = SPI_Transfer_data(DEFAULT_ACK);//minutes
+                    min_off = SPI_Transfer_data(DEFAULT_ACK);//minutes
+                    deadband = SPI_Transfer_data(DEFAULT_ACK);//tenths of a degree
+                    if((min_on >= AC_MIN_TIME_MIN) && (min_on <= AC_MIN_TIME_MAX) &&
+                       (min_off >= AC_MIN_TIME_MIN) && (min_off <= AC_MIN_TIME_MAX) &&
+                       (deadband >= THERMOSTAT_DEADBAND_MIN) && (deadband <= THERMOSTAT_DEADBAND_MAX))//all or nothing
+                    {
+                        ac_min_on = min_on;
+                        ac_min_off = min_off;
+                        thermostat_deadband = deadband;
+                    }
+                    break;
+                case GET_AC_PROTECT:
+                    SPI_Transfer_data(ac_min_on);
+                    SPI_Transfer_data(ac_min_off);
+                    SPI_Transfer_data(thermostat_deadband);
+                    SPI_Transfer_data((uint8)(ac_lockout >> 8));//remaining lockout in seconds
+                    SPI_Transfer_data((uint8)ac_lockout);
+                    SPI_Transfer_data((uint8)(ac_switch_count >> 8));
+                    SPI_Transfer_data((uint8)ac_switch_count);
+                    break;
+            }
+            SPI_Write_Data_Nonblocking(DEFAULT_ACK);//the reply to the next request byte
         }
         
+        Thermostat_Task();
     }
     return 0;
 }
 
 void TMR0_InterruptHandler(void)
 {
-    counter++;//count the ticks of the timer zero
-    if(counter >= 10)//do that code every 10 ticks 
+    static uint8 control_ticks = 0;
+    
+    adc_scan_tick();//the rate window of the scan, the CCP2 trigger starts the conversions
+    control_ticks++;
+    if(control_ticks >= THERMOSTAT_CONTROL_TICKS)//the control runs at a fixed rate, independent of the loop load
+    {
+        control_ticks = 0;
+        control_due = TRUE;
+    }
+}
+
+void ADC_InterruptHandler(void)
+{
+    adc_scan_isr();//collect the result, the tasks of the main loop process it
+}
+
+void Thermostat_Task(void)
+{
+    adc_scan_snapshot_t snapshot;
+    uint16 filtered = 0;
+    uint8 room_counter = 0;
+    
+    adc_scan_snapshot(&snapshot);
+    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)
+    {
+        if(snapshot.results_count[room_counter] == rooms_results_count[room_counter])//no new result of this room
+        {
+            continue;
+        }
+        rooms_results_count[room_counter] = snapshot.results_count[room_counter];
+        temp_sensor_iir(&rooms_filter[room_counter], snapshot.results[room_counter], &filtered);
+        temp_sensor_linearize(Rooms_sensor[room_counter], filtered, &rooms_raw_temperature[room_counter]);//LM35 or NTC
+        temp_sensor_calibrate(&rooms_calib[room_counter], rooms_raw_temperature[room_counter], &rooms_temperature[room_counter]);
+    }
+    if(control_due == FALSE)//the control runs once per control step
+    {
+        return;
+    }
+    control_due = FALSE;
+    if(ac_lockout > 0)//the lockout counts down even while the thermostat is off
+    {
+        ac_lockout--;
+    }
+    uptime_seconds++;
+    if(0 == (uptime_seconds % HISTORY_PERIOD_STEPS))
+    {
+        temp_history_push(&Room_history, rooms_temperature[THERMOSTAT_ROOM], uptime_seconds);
+    }
+    if(thermostat_enabled == FALSE)//the air conditioning is turned off by the master
+    {
+        return;
+    }
+    if(THERMOSTAT_MODE_HYSTERESIS == thermostat_mode)
+    {
+        Thermostat_Hysteresis(rooms_temperature[THERMOSTAT_ROOM], required_temperature);
+        return;
+    }
+    //cooling: a room warmer than required drives the output up
+    pi_controller_update(&Thermostat_pi, rooms_temperature[THERMOSTAT_ROOM] - required_temperature, &thermostat_output);
+    if(THERMOSTAT_MODE_PWM == thermostat_mode)
+    {
+        Air_Cond_Duty((uint8)(((uint16)thermostat_output * air_conditioning_speed) / PI_CONTROLLER_OUTPUT_MAX));
+    }
+    else
+    {
+        Thermostat_Window(thermostat_output);
+    }
+}
+
+void Thermostat_Reset(void)
+{
+    pi_controller_reset(&Thermostat_pi);
+    thermostat_output = 0;
+    window_step = 0;//a new window starts on the next control step
+}
+
+void Thermostat_Hysteresis(const sint16 current_deci, const sint16 required_deci)
+{
+    if(current_deci >= (required_deci + (sint16)thermostat_deadband))//do that code if the read temperature if greater than required temperature by one or more
+    {
+        Air_Cond_Output(AIR_CONDTIONING_ON);//turn on the air conditioning
+        last_air_conditioning_value = AIR_CONDTIONING_ON;//save the value of the state of the air conditioning
+    }
+    else if(current_deci <= (required_deci - (sint16)thermostat_deadband))
     {   
-        counter = 0;//clear the counter of ticks
-        ADC_Get_Conversion_Blocking(&adc0, ADC_CHANNEL_AN0,&adc_res);
-        temp_sensor_reading = ADC_STEP * adc_res;
-        temp_sensor_reading /= 10;
-        if(temp_sensor_reading >= (required_temperature+1))//do that code if the read temperature if greater than required temperature by one or more
-		{
-			led_turn_on(&Air_Cond_led);//turn on the led of air conditioning
-			last_air_conditioning_value = AIR_CONDTIONING_ON;//save the value of the state of the air conditioning
-		}
-        else if(temp_sensor_reading <= (required_temperature-1))
-        {   
-            led_turn_off(&Air_Cond_led);//turn off the led of air conditioning
-            last_air_conditioning_value=AIR_CONDTIONING_OFF;//save the value of the state of the air conditioning
+        Air_Cond_Output(AIR_CONDTIONING_OFF);//turn off the air conditioning
+        last_air_conditioning_value = AIR_CONDTIONING_OFF;//save the value of the state of the air conditioning
+    }
+    else//inside the hysteresis band, keep the last state of the air conditioning
+    {
+        Air_Cond_Output(last_air_conditioning_value);
+    }
+}
+
+void Thermostat_Window(const uint8 output)
+{
+    uint16 on_steps = 0;//on-time of the window for the current output
+    
+    on_steps = (uint16)(((uint32)output * THERMOSTAT_WINDOW_STEPS) / PI_CONTROLLER_OUTPUT_MAX);
+    if(on_steps < THERMOSTAT_MIN_PULSE_STEPS)
+    {
+        on_steps = 0;
+    }
+    else if(on_steps > (THERMOSTAT_WINDOW_STEPS - THERMOSTAT_MIN_PULSE_STEPS))
+    {
+        on_steps = THERMOSTAT_WINDOW_STEPS;
+    }else{/* Nothing */}
+    //The on-time follows the output only while the on part is running, once off it stays off till
+    //the end of the window, so the output switches at most twice per window
+    if(0 == window_step)
+    {
+        window_on_steps = on_steps;
+    }
+    else if(window_step < window_on_steps)
+    {
+        window_on_steps = (on_steps > window_step) ? on_steps : window_step;
+    }else{/* Nothing */}
+    
+    if(window_step < window_on_steps)
+    {
+        Air_Cond_Output(AIR_CONDTIONING_ON);
+    }
+    else
+    {
+        Air_Cond_Output(AIR_CONDTIONING_OFF);
+    }
+    window_step++;
+    if(window_step >= THERMOSTAT_WINDOW_STEPS)
+    {
+        window_step = 0;
+    }
+}
+
+uint8 Device_Bit(const uint8 command)
+{
+    uint8 device_bit = 0x00;
+    //the low nibble of status, turn on and turn off commands is the device number
+    switch(command & 0x0F)
+    {
+        case 0x01: device_bit = ROOM1_BIT; break;
+        case 0x02: device_bit = ROOM2_BIT; break;
+        case 0x03: device_bit = ROOM3_BIT; break;
+        case 0x04: device_bit = ROOM4_BIT; break;
+        case 0x05: device_bit = TV_BIT; break;
+        case 0x06: device_bit = AIR_COND_BIT; break;
+        default: break;
+    }
+    return device_bit;
+}
+
+uint8 Devices_State(void)
+{
+    uint8 devices_state = 0x00;
+    uint8 room_counter = 0;
+    uint8 level = SOFT_PWM_LEVEL_OFF;
+    
+    led_bank_read(&Devices_bank, &devices_state);
+    //the bank bits of the rooms follow the PWM waveform, a room is on if its level isn't zero
+    devices_state &= ~ROOMS_MASK;
+    for(room_counter = 0; room_counter < SOFT_PWM_CHANNELS_NUM; room_counter++)
+    {
+        soft_pwm_get_level(room_counter, &level);
+        if(SOFT_PWM_LEVEL_OFF != level)
+        {
+            devices_state |= Rooms_pwm.channel_mask[room_counter];
+        }
+    }
+    return devices_state;
+}
+
+void Rooms_Apply(const uint8 on_mask, const uint8 off_mask)
+{
+    uint8 room_counter = 0;
+    
+    for(room_counter = 0; room_counter < SOFT_PWM_CHANNELS_NUM; room_counter++)
+    {
+        if(on_mask & Rooms_pwm.channel_mask[room_counter])
+        {
+            soft_pwm_set_level(room_counter, SOFT_PWM_LEVEL_MAX);//turn on at full level
+        }
+        else if(off_mask & Rooms_pwm.channel_mask[room_counter])
+        {
+            soft_pwm_set_level(room_counter, SOFT_PWM_LEVEL_OFF);
+        }else{/* Nothing */}
+    }
+}
+
+void Air_Cond_Output(const uint8 state)
+{
+    if(AIR_CONDTIONING_ON == state)
+    {
+        Air_Cond_Duty(air_conditioning_speed);//run the fan at the selected speed
+    }
+    else
+    {
+        Air_Cond_Duty(CCP_PWM_DUTY_MIN);//stop the fan
+    }
+}
+
+void Air_Cond_Duty(const uint8 duty)
+{
+    if((CCP_PWM_DUTY_MIN != duty) && (ac_running == FALSE))//start request
+    {
+        if(ac_lockout > 0)//inside the minimum off-time, stay off
+        {
+            return;
+        }
+        ac_running = TRUE;
+        ac_lockout = (uint16)ac_min_on * AC_SECONDS_PER_MINUTE;
+        ac_switch_count++;
+        led_bank_apply(&Devices_bank, AIR_COND_BIT, LED_BANK_NO_CHANGE);//turn on the led of air conditioning
+    }
+    else if((CCP_PWM_DUTY_MIN == duty) && (ac_running == TRUE))//stop request
+    {
+        if(ac_lockout > 0)//inside the minimum on-time, keep the current duty
+        {
+            return;
+        }
+        Air_Cond_Stop();
+        return;
+    }else{/* Nothing */}
+    CCP_PWM_Set_Duty(&Air_cond_fan, duty);
+}
+
+void Air_Cond_Stop(void)
+{
+    if(ac_running == TRUE)
+    {
+        ac_running = FALSE;
+        ac_lockout = (uint16)ac_min_off * AC_SECONDS_PER_MINUTE;//the restart waits for the minimum off-time
+        ac_switch_count++;
+    }
+    led_bank_apply(&Devices_bank, LED_BANK_NO_CHANGE, AIR_COND_BIT);//turn off the led of air conditioning
+    CCP_PWM_Set_Duty(&Air_cond_fan, CCP_PWM_DUTY_MIN);//stop the fan
+}
+
+void Calibration_Load(void)
+{
+    uint8 record[CALIB_RECORD_SIZE];
+    uint8 check = 0;
+    uint8 room_counter = 0;
+    uint8 byte_counter = 0;
+    
+    for(room_counter = 0; room_counter < ROOMS_NUM; room_counter++)
+    {
+        rooms_calib[room_counter].gain_q14 = TEMP_SENSOR_GAIN_ONE;//the ideal sensor until a valid record is found
+        rooms_calib[room_counter].offset_deci = 0;
+        if(E_OK != EEPROM_ReadBlock(CALIB_EEPROM_ADDRESS + ((uint16)room_counter * CALIB_RECORD_SIZE), record, CALIB_RECORD_SIZE))
+        {
+            continue;
+        }
+        check = CALIB_CHECK_SEED;//an erased EEPROM (all 0xFF) fails the check
+        for(byte_counter = 0; byte_counter < (CALIB_RECORD_SIZE - 1); byte_counter++)
+        {
+            check += record[byte_counter];
+        }
+        if(check != record[CALIB_RECORD_SIZE - 1])
+        {
+            continue;
+        }
+        rooms_calib[room_counter].gain_q14 = ((uint16)record[0] << 8) | record[1];
+        rooms_calib[room_counter].offset_deci = (sint16)(((uint16)record[2] << 8) | record[3]);
+        if((rooms_calib[room_counter].gain_q14 < TEMP_SENSOR_GAIN_MIN) || (rooms_calib[room_counter].gain_q14 > TEMP_SENSOR_GAIN_MAX))
+        {
+            rooms_calib[room_counter].gain_q14 = TEMP_SENSOR_GAIN_ONE;
+            rooms_calib[room_counter].offset_deci = 0;
+        }
+    }
+}
+
+Std_ReturnType Calibration_Store(const uint8 room)
+{
+    uint8 record[CALIB_RECORD_SIZE];
+    uint8 byte_counter = 0;
+    
+    if(room >= ROOMS_NUM)
+    {
+        return E_NOT_OK;
+    }
+    record[0] = (uint8)(rooms_calib[room].gain_q14 >> 8);
+    record[1] = (uint8)rooms_calib[room].gain_q14;
+    record[2] = (uint8)((uint16)rooms_calib[room].offset_deci >> 8);
+    record[3] = (uint8)rooms_calib[room].offset_deci;
+    record[CALIB_RECORD_SIZE - 1] = CALIB_CHECK_SEED;
+    for(byte_counter = 0; byte_counter < (CALIB_RECORD_SIZE - 1); byte_counter++)
+    {
+        record[CALIB_RECORD_SIZE - 1] += record[byte_counter];
+    }
+    //queued, the record is written in the background by the EEPROM interrupt (about 20 ms)
+    return EEPROM_WriteBlock_Async(CALIB_EEPROM_ADDRESS + ((uint16)room * CALIB_RECORD_SIZE), record, CALIB_RECORD_SIZE, NULL);
+}
+
+void Convert_Measure(uint16 *q8_8_cycles, uint16 *float_cycles)
+{
+    uint16 start = 0, stop = 0, overhead = CONVERT_NOT_MEASURED;
+    uint16 filtered = 0;
+    uint8 run_counter = 0;
+    sint16 deci = 0;
+    
+    //the filtered result of the room as the last Thermostat_Task converted it, the float timing depends on the value
+    filtered = (uint16)((rooms_filter[THERMOSTAT_ROOM].iir_state + (1U << (TEMP_SENSOR_IIR_SHIFT - 1))) >> TEMP_SENSOR_IIR_SHIFT);
+    *q8_8_cycles = CONVERT_NOT_MEASURED;
+    *float_cycles = CONVERT_NOT_MEASURED;
+    for(run_counter = 0; run_counter < CONVERT_MEASURE_RUNS; run_counter++)
+    {
+        //the two reads back to back, taken off the conversions
+        Timer1_Read(&Sampling_timer, &start);
+        Timer1_Read(&Sampling_timer, &stop);
+        if((stop >= start) && ((uint16)(stop - start) < overhead))
+        {
+            overhead = stop - start;
         }
-        else if(required_temperature == temp_sensor_reading)//do that code if the read temperature is equal to the required temperature
-		{
-			if(last_air_conditioning_value == AIR_CONDTIONING_ON)//in the case of the last saved status of the air conditioning was on 
-			{
-				led_turn_on(&Air_Cond_led);//turn on the led of the air conditioning
-			}
-			else if(last_air_conditioning_value == AIR_CONDTIONING_OFF)//in the case of the last saved status of the air conditioning was off 
-			{
-				led_turn_off(&Air_Cond_led);//turn off the led of the air conditioning
-			}
-		}
-    }
-}
\ No newline at end of file
+        Timer1_Read(&Sampling_timer, &start);
+        temp_sensor_to_deci_celsius(filtered, &deci);
+        Timer1_Read(&Sampling_timer, &stop);
+        if((stop >= start) && ((uint16)(stop - start) < *q8_8_cycles))//a run across the reset reads backwards
+        {
+            *q8_8_cycles = stop - start;
+        }
+#if TEMP_SENSOR_FLOAT_REFERENCE
+        Timer1_Read(&Sampling_timer, &start);
+        temp_sensor_float_to_deci_celsius(filtered, &deci);
+        Timer1_Read(&Sampling_timer, &stop);
+        if((stop >= start) && ((uint16)(stop - start) < *float_cycles))
+        {
+            *float_cycles = stop - start;
+        }
+#endif
+    }
+    if(CONVERT_NOT_MEASURED == overhead)//every run crossed the reset, nothing is reported
+    {
+        *q8_8_cycles = CONVERT_NOT_MEASURED;
+        *float_cycles = CONVERT_NOT_MEASURED;
+        return;
+    }
+    if(CONVERT_NOT_MEASURED != *q8_8_cycles)
+    {
+        *q8_8_cycles -= overhead;
+    }
+    if(CONVERT_NOT_MEASURED != *float_cycles)
+    {
+        *float_cycles -= overhead;
+    }
+}
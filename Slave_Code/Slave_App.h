@@ -29,7 +29,72 @@
 #define ROOM3_PORT   				(uint8)'D'
 #define ROOM4_PORT    				(uint8)'D'
 
-#define ADC_STEP                    4.88f
+#define THERMOSTAT_DEADBAND_DEFAULT (uint8)10 //tenths of a degree above/below the required temperature
+#define SETPOINT_DEFAULT            (sint16)240 //required temperature in tenths of a degree
+#define SETPOINT_MIN                (sint16)100
+#define SETPOINT_MAX                (sint16)350
+
+#define AC_SPEED_DEFAULT            (uint8)100 //fan speed in percent when the thermostat turns the air conditioning on
+
+/****************************   Thermostat control  *****************************************/
+#define THERMOSTAT_MODE_HYSTERESIS  (uint8)0   //on/off around the required temperature
+#define THERMOSTAT_MODE_WINDOW      (uint8)1   //PI output as the on-time of a fixed window
+#define THERMOSTAT_MODE_PWM         (uint8)2   //PI output as the fan duty
+#define THERMOSTAT_MODES_NUM        (uint8)3
+
+#define THERMOSTAT_CONTROL_TICKS    (uint8)200 //Timer0 ticks (5 ms) per control step, must match PI_CONTROLLER_STEP_MS
+/* An on/off cycle switches the compressor twice whatever drives it, so the window sets the switching rate:
+   15 min switches less than the hysteresis loop (about 8 against 9 per hour in thermostat_sim.py) */
+#define THERMOSTAT_WINDOW_STEPS     (uint16)900 //control steps per time-proportioning window (15 min)
+#define THERMOSTAT_MIN_PULSE_STEPS  (uint16)120 //shorter on or off pulses of a window are dropped (2 min)
+#define THERMOSTAT_KP_DEFAULT       (uint8)20  //percent per degree
+#define THERMOSTAT_KI_DEFAULT       (uint8)5   //percent per degree per minute
+
+/****************************   Compressor protection  *****************************************/
+#define AC_MIN_ON_DEFAULT           (uint8)3   //minutes the compressor runs at least once started
+#define AC_MIN_OFF_DEFAULT          (uint8)5   //minutes the compressor rests at least once stopped
+#define AC_SECONDS_PER_MINUTE       (uint16)60 //the lockout counts down once per control step (1 s)
+#define AC_MIN_TIME_MIN             (uint8)1   //range of the minimum on/off times in minutes, a set out of it is ignored
+#define AC_MIN_TIME_MAX             (uint8)30
+#define THERMOSTAT_DEADBAND_MIN     (uint8)2   //range of the deadband in tenths of a degree, below it the compressor chatters
+#define THERMOSTAT_DEADBAND_MAX     (uint8)50
+
+/****************************   Temperature sampling  *****************************************/
+#define ROOMS_NUM                   ADC_SCAN_CHANNELS_NUM //one sensor per room, in the order of the scan list
+#define THERMOSTAT_ROOM             (uint8)0   //index of the room sensor that controls the air conditioning
+#define HISTORY_PERIOD_STEPS        (uint8)TEMP_HISTORY_PERIOD_S //control steps (1 s) between two history samples
+/* GET_CONVERT_LOAD times the conversion of the thermostat room with Timer1 (Fosc/4, reset every 5 ms):
+   the shortest of the runs is kept, a run hit by an interrupt or by the reset only lasts longer */
+#define CONVERT_MEASURE_RUNS        (uint8)8
+#define CONVERT_NOT_MEASURED        (uint16)0xFFFF //no run fit between two resets, or the float conversion isn't linked
+
+/****************************   Sensor calibration  *****************************************/
+/* Every room keeps CALIB_RECORD_SIZE bytes in the data EEPROM: gain (Q2.14) and offset (tenths),
+   high byte first, then a check byte, a record that fails the check loads as the ideal sensor */
+#define CALIB_EEPROM_ADDRESS        (uint16)0x00
+#define CALIB_RECORD_SIZE           (uint8)5
+#define CALIB_CHECK_SEED            (uint8)0x5A
+#define CALIB_POINTS_NUM            (uint8)2
+#define CALIB_ALL_POINTS            (uint8)0x03 //one bit per captured point
+#define CALIB_FAILED                (uint8)0x00
+#define CALIB_DONE                  (uint8)0x01
+#define CALIB_NOT_SAVED             (uint8)0x02 //applied but the EEPROM write couldn't be queued, lost at reset
+
+#define FALSE                       (uint8)0
+#define TRUE                        (uint8)1
+
+/****************************   Devices bank bits  *****************************************/
+#define ROOM1_BIT                   LED_BANK_BIT(GPIO_PIN0)
+#define ROOM2_BIT                   LED_BANK_BIT(GPIO_PIN1)
+#define ROOM3_BIT                   LED_BANK_BIT(GPIO_PIN2)
+#define ROOM4_BIT                   LED_BANK_BIT(GPIO_PIN3)
+#define TV_BIT                      LED_BANK_BIT(GPIO_PIN4)
+#define AIR_COND_BIT                LED_BANK_BIT(GPIO_PIN5)
+
+#define DEVICES_BANK_MASK           (uint8)(ROOM1_BIT | ROOM2_BIT | ROOM3_BIT | ROOM4_BIT | TV_BIT | AIR_COND_BIT)
+#define ROOMS_MASK                  (uint8)(ROOM1_BIT | ROOM2_BIT | ROOM3_BIT | ROOM4_BIT)
+//The air conditioning is owned by the thermostat so scenes can't switch it
+#define SCENE_DEVICES_MASK          (uint8)(ROOM1_BIT | ROOM2_BIT | ROOM3_BIT | ROOM4_BIT | TV_BIT)
 /****************************   Std msgs  *****************************************/
 #define ROOM1_STATUS    0x11
 #define ROOM2_STATUS    0x12
@@ -37,6 +102,7 @@
 #define ROOM4_STATUS    0x14
 #define TV_STATUS 		0x15
 #define AIR_COND_STATUS 0x16
+#define DEVICES_STATUS  0x17
 
 #define ROOM1_TURN_ON    0x21
 #define ROOM2_TURN_ON    0x22
@@ -53,6 +119,29 @@
 #define AIR_COND_TURN_OFF 0x36
 
 #define SET_TEMPERATURE 0x40
+#define GET_TEMPERATURE 0x41
+#define GET_ALL_TEMPS   0x42
+#define GET_SCAN_RATE   0x43
+#define GET_TEMP_HISTORY 0x44
+#define GET_TEMP_STATS  0x45
+#define CALIB_POINT     0x46
+#define CALIB_APPLY     0x47
+#define CALIB_RESET     0x48
+#define GET_CALIB       0x49
+
+#define SET_CTRL_MODE   0x60
+#define SET_PI_GAINS    0x61
+#define GET_CTRL_STATE  0x62
+#define SET_AC_PROTECT  0x63
+#define GET_AC_PROTECT  0x64
+
+#define SET_SCENE       0x50
+#define SET_LEVEL       0x51
+#define GET_LEVEL       0x52
+#define GET_PWM_LOAD    0x53
+#define SET_AC_SPEED    0x54
+#define GET_AC_SPEED    0x55
+#define GET_CONVERT_LOAD 0x56
 
 #define DEFAULT_ACK    0xFF
 #define DEMAND_RESPONSE 0xFF
@@ -63,18 +152,34 @@
 
 
 /* Section : Data Types Declarations  */
-extern led_t Room1_led;
-extern led_t Room2_led;
-extern led_t Room3_led;
-extern led_t Room4_led;
-extern led_t TV_led;
-extern led_t Air_Cond_led;
+extern led_bank_t Devices_bank;
+extern soft_pwm_t Rooms_pwm;
 
 extern spi_t spi;
 extern timer0_t timer;
 extern adc_config_t adc0;
+extern adc_scan_t Rooms_scan;
+extern const temp_sensor_type_t Rooms_sensor[ROOMS_NUM];
+extern timer2_t Fan_timer;
+extern ccp_t Air_cond_fan;
+extern timer1_t Sampling_timer;
+extern ccp_t Sampling_trigger;
 
 /* Section : Functions Declarations */
 void TMR0_InterruptHandler(void);
+void ADC_InterruptHandler(void);
+void Thermostat_Task(void);
+void Thermostat_Reset(void);
+void Thermostat_Hysteresis(const sint16 current_deci, const sint16 required_deci);
+void Thermostat_Window(const uint8 output);
+uint8 Device_Bit(const uint8 command);
+uint8 Devices_State(void);
+void Rooms_Apply(const uint8 on_mask, const uint8 off_mask);
+void Air_Cond_Output(const uint8 state);
+void Air_Cond_Duty(const uint8 duty);
+void Air_Cond_Stop(void);
+void Calibration_Load(void);
+Std_ReturnType Calibration_Store(const uint8 room);
+void Convert_Measure(uint16 *q8_8_cycles, uint16 *float_cycles);
 #endif	/* SLAVE_APP_H */
 